@@ -0,0 +1,92 @@
+/*
+ * The benchmarks: timing and reporting, see bench.h
+ */
+#include <sys/resource.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+double bench_secs = 0.5;
+
+/*
+ * The cycles are only informational, so we do not care if rdtsc is
+ * not serializing. Where there is no TSC, we count nanoseconds instead.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES_UNIT "cycles"
+unsigned long long bench_cycles(void) { return __rdtsc(); }
+#else
+#define CYCLES_UNIT "ns"
+unsigned long long bench_cycles(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+static double bench_elapsed(const struct bench *bp)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - bp->t0.tv_sec) +
+	    (now.tv_nsec - bp->t0.tv_nsec) / 1e9;
+}
+
+void bench_begin(struct bench *bp, const char *name)
+{
+	memset(bp, 0, sizeof(struct bench));
+	bp->name = name;
+	clock_gettime(CLOCK_MONOTONIC, &bp->t0);
+	bp->c0 = bench_cycles();
+}
+
+/*
+ * Call before every iteration. The clock is read every time, so an
+ * iteration should be a buffer, or a batch of codewords.
+ */
+int bench_more(struct bench *bp)
+{
+	if (bp->iters != 0 && bench_elapsed(bp) >= bench_secs)
+		return 0;
+	bp->iters++;
+	return 1;
+}
+
+void bench_end(struct bench *bp)
+{
+	unsigned long long cycles = bench_cycles() - bp->c0;
+	struct rusage ru;
+	double secs;
+
+	secs = bench_elapsed(bp);
+	if (secs <= 0)
+		secs = 1e-9;
+	getrusage(RUSAGE_SELF, &ru);
+
+	printf("{\"bench\":\"%s\",\"iters\":%lu,\"secs\":%.3f",
+	    bp->name, bp->iters, secs);
+	if (bp->samples != 0) {
+		printf(",\"samples\":%lu,\"ns_per_sample\":%.3f"
+		    ",\"msamples_per_s\":%.2f",
+		    bp->samples, secs * 1e9 / bp->samples,
+		    bp->samples / secs / 1e6);
+	}
+	if (bp->codewords != 0) {
+		printf(",\"codewords\":%lu"
+		    ",\"" CYCLES_UNIT "_per_codeword\":%.0f"
+		    ",\"ns_per_codeword\":%.1f",
+		    bp->codewords, (double) cycles / bp->codewords,
+		    secs * 1e9 / bp->codewords);
+	}
+	if (bp->ops != 0) {
+		printf(",\"ops\":%lu,\"ns_per_op\":%.3f",
+		    bp->ops, secs * 1e9 / bp->ops);
+	}
+	printf(",\"peak_rss_kb\":%ld}\n", ru.ru_maxrss);
+	fflush(stdout);
+}
@@ -0,0 +1,37 @@
+/*
+ * The benchmarks: timing of the hot paths, see bench_ruat.c and
+ * bench_airspy.c, and "make bench"
+ *
+ * Every benchmark runs its loop until bench_more() says it's been long
+ * enough, counting what it did in samples or codewords, and bench_end()
+ * prints one line of JSON for it, such as:
+ *
+ *   {"bench":"scan_iq_noise_run","iters":120,"secs":0.501,
+ *    "samples":31457280,"ns_per_sample":15.93,"msamples_per_s":62.77,
+ *    "peak_rss_kb":23040}
+ *
+ * The samples are those of the input, as the device makes them: I/Q
+ * pairs for ruat, and real samples for ruat_airspy. The codewords are
+ * Reed-Solomon blocks, so an Uplink counts as 6, and their cost is in
+ * the cycles of the TSC where there's one, and in ns elsewhere. The ops
+ * are anything smaller, such as a multiplication in the field.
+ */
+#include <time.h>
+
+struct bench {
+	const char *name;
+	struct timespec t0;
+	unsigned long long c0;
+	double secs;
+	unsigned long iters;
+	unsigned long samples;		/* the caller counts these */
+	unsigned long codewords;	/* and these */
+	unsigned long ops;		/* or these, such as products */
+};
+
+extern double bench_secs;	/* the least that every benchmark runs */
+
+unsigned long long bench_cycles(void);
+void bench_begin(struct bench *bp, const char *name);
+int bench_more(struct bench *bp);
+void bench_end(struct bench *bp);
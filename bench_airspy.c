@@ -0,0 +1,194 @@
+/*
+ * bench_airspy: time the hot paths of ruat_airspy, see bench.h
+ *
+ * This includes ruat_airspy.c, so that its static functions are timed
+ * as they are, with main() renamed out of the way. The samples are made
+ * by the synthesizer, or taken from a raw16 capture given with -f.
+ * The packed samples of Airspy are timed as well, as "_raw12".
+ */
+#define main ruat_airspy_main
+#include "ruat_airspy.c"
+#undef main
+#undef TAG
+
+#include <errno.h>
+
+#include "bench.h"
+#include "synth.h"
+
+#define TAG "bench_airspy"
+
+#define BENCH_SAMPLES  (16*1024*1024)	/* under a second at AIRSPY_RATE */
+
+static void bench_convert(const char *name, const unsigned char *buf,
+    size_t nsamples, int packed);
+static void bench_scan(const char *name, const unsigned char *buf,
+    size_t nsamples, int packed);
+static void bench_fir(int packed);
+static unsigned char *bench_signal(double snr, int bursts, int format);
+static unsigned char *bench_capture(const char *path, size_t *np);
+static void bench_usage(void);
+
+int main(int argc, char **argv)
+{
+	const char *capture = NULL;
+	unsigned char *noise, *traffic, *noise12, *traffic12, *cap;
+	size_t capn;
+	char *arg;
+
+	argv += 1;
+	while ((arg = *argv++) != NULL) {
+		if (strcmp(arg, "-t") == 0) {
+			if ((arg = *argv++) == NULL)
+				bench_usage();
+			bench_secs = strtod(arg, NULL);
+			if (bench_secs <= 0)
+				bench_usage();
+		} else if (strcmp(arg, "-f") == 0) {
+			if ((capture = *argv++) == NULL)
+				bench_usage();
+		} else {
+			bench_usage();
+		}
+	}
+
+	noise = bench_signal(0, 0, SYNTH_RAW16);
+	traffic = bench_signal(20, 1, SYNTH_RAW16);
+	noise12 = bench_signal(0, 0, SYNTH_RAW12);
+	traffic12 = bench_signal(20, 1, SYNTH_RAW12);
+
+	bench_convert("convert", noise, BENCH_SAMPLES, 0);
+	bench_convert("convert_raw12", noise12, BENCH_SAMPLES, 1);
+	bench_scan("scan_buf_noise", noise, BENCH_SAMPLES, 0);
+	bench_scan("scan_buf_traffic", traffic, BENCH_SAMPLES, 0);
+	bench_scan("scan_buf_traffic_raw12", traffic12, BENCH_SAMPLES, 1);
+	if (capture != NULL) {
+		cap = bench_capture(capture, &capn);
+		bench_scan("scan_buf_capture", cap, capn, 0);
+		free(cap);
+	}
+
+	free(noise);
+	free(traffic);
+	free(noise12);
+	free(traffic12);
+	return 0;
+}
+
+/*
+ * The dc bias, the mixing by fs/4, and the channel filter.
+ */
+static void bench_convert(const char *name, const unsigned char *buf,
+    size_t nsamples, int packed)
+{
+	struct bench b;
+	size_t off;
+	int m;
+
+	bench_fir(packed);
+	bench_begin(&b, name);
+	while (bench_more(&b)) {
+		for (off = 0; off < nsamples; off += m) {
+			m = (nsamples - off < CVT_SAMPLES) ?
+			    nsamples - off : CVT_SAMPLES;
+			convert(buf + (packed ? off / 8 * 12 : off * 2), m,
+			    cvt_buf);
+		}
+		b.samples += nsamples;
+	}
+	bench_end(&b);
+	fir_fini(&fir);
+}
+
+/*
+ * The conversion and the scan, as the main loop does them.
+ */
+static void bench_scan(const char *name, const unsigned char *buf,
+    size_t nsamples, int packed)
+{
+	struct rx_state rs;
+	struct bench b;
+	size_t off;
+	int m, n;
+
+	if (rx_state_init(&rs) != 0) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+	bench_fir(packed);
+	bench_begin(&b, name);
+	while (bench_more(&b)) {
+		for (off = 0; off < nsamples; off += m) {
+			m = (nsamples - off < CVT_SAMPLES) ?
+			    nsamples - off : CVT_SAMPLES;
+			n = convert(buf + (packed ? off / 8 * 12 : off * 2), m,
+			    cvt_buf);
+			scan_buf(&rs, cvt_buf, n / 2);
+		}
+		b.samples += nsamples;
+	}
+	bench_end(&b);
+	fir_fini(&fir);
+}
+
+static void bench_fir(int packed)
+{
+	if (fir_init(&fir, CVT_SAMPLES, packed) != 0) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+}
+
+static unsigned char *bench_signal(double snr, int bursts, int format)
+{
+	struct synth_conf yconf;
+	struct synth synth;
+	unsigned char *buf;
+
+	if ((buf = malloc(BENCH_SAMPLES * 2)) == NULL) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+	memset(&yconf, 0, sizeof(yconf));
+	yconf.format = format;
+	yconf.rate = AIRSPY_RATE;
+	yconf.snr = snr;
+	if (synth_init(&synth, &yconf) != 0)
+		exit(1);
+	synth.limit = bursts ? BENCH_SAMPLES : 1;
+	synth_gen(&synth, buf, BENCH_SAMPLES);
+	synth_fini(&synth);
+	return buf;
+}
+
+static unsigned char *bench_capture(const char *path, size_t *np)
+{
+	unsigned char *buf;
+	size_t size, len;
+	FILE *fp;
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		fprintf(stderr, TAG ": %s: %s\n", path, strerror(errno));
+		exit(1);
+	}
+	/* Up to 64 MB, the rest would only make it longer */
+	size = 64*1024*1024;
+	if ((buf = malloc(size)) == NULL) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+	len = fread(buf, 1, size, fp) & ~7;
+	fclose(fp);
+	if (len == 0) {
+		fprintf(stderr, TAG ": %s: No samples\n", path);
+		exit(1);
+	}
+	*np = len / 2;
+	return buf;
+}
+
+static void bench_usage(void)
+{
+	fprintf(stderr, "Usage: " TAG " [-t seconds] [-f capture.raw16]\n");
+	exit(1);
+}
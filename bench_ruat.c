@@ -0,0 +1,321 @@
+/*
+ * bench_ruat: time the hot paths of ruat, see bench.h
+ *
+ * This includes ruat.c, so that its static functions are timed as they
+ * are, with main() renamed out of the way. The samples are made by the
+ * synthesizer, or taken from a capture given with -f.
+ */
+#define main ruat_main
+#include "ruat.c"
+#undef main
+#undef TAG
+
+#include <errno.h>
+#include <fcntl.h>
+
+#include "bench.h"
+#include "synth.h"
+
+#define TAG "bench_ruat"
+
+#define BENCH_SAMPLES  (2*1024*1024)	/* about a second at UAT_RATE */
+#define BENCH_CHUNK    (256*1024)	/* bytes, as the USB buffers */
+#define BENCH_FRAMES   64
+
+static void bench_phi(const unsigned char *buf, size_t len);
+static void bench_scan(const char *name, const unsigned char *buf,
+    size_t len, int mode);
+static void bench_decode(const char *name, int kind, int nerrs);
+static void bench_fec(void);
+static unsigned char *bench_signal(double snr, int bursts);
+static unsigned char *bench_capture(const char *path, size_t *lenp);
+static void bench_usage(void);
+
+int main(int argc, char **argv)
+{
+	static char *defaults[] = { "ruat", NULL };
+	const char *capture = NULL;
+	unsigned char *noise, *traffic, *cap;
+	size_t caplen;
+	char *arg;
+	int fd;
+
+	argv += 1;
+	while ((arg = *argv++) != NULL) {
+		if (strcmp(arg, "-t") == 0) {
+			if ((arg = *argv++) == NULL)
+				bench_usage();
+			bench_secs = strtod(arg, NULL);
+			if (bench_secs <= 0)
+				bench_usage();
+		} else if (strcmp(arg, "-f") == 0) {
+			if ((capture = *argv++) == NULL)
+				bench_usage();
+		} else {
+			bench_usage();
+		}
+	}
+
+	/* The defaults of ruat, but every frame is decoded where it's found */
+	params(&par, 1, defaults);
+	par.fec_threads = 0;
+	preload_phi();
+	init_field();
+	if ((fd = open("/dev/null", O_WRONLY)) == -1 ||
+	    writer_init(&out_w, fd, OUT_BATCH, 0) != 0) {
+		fprintf(stderr, TAG ": Unable to start the writer\n");
+		exit(1);
+	}
+
+	noise = bench_signal(0, 0);
+	traffic = bench_signal(20, 1);
+
+	bench_phi(noise, BENCH_SAMPLES * 2);
+	bench_scan("scan_iq_noise_run", noise, BENCH_SAMPLES * 2, MODE_RUN);
+	bench_scan("scan_iq_noise_corr", noise, BENCH_SAMPLES * 2, MODE_CORR);
+	bench_scan("scan_iq_traffic_run", traffic, BENCH_SAMPLES * 2,
+	    MODE_RUN);
+	bench_scan("scan_iq_traffic_corr", traffic, BENCH_SAMPLES * 2,
+	    MODE_CORR);
+	if (capture != NULL) {
+		cap = bench_capture(capture, &caplen);
+		bench_scan("scan_iq_capture_run", cap, caplen, MODE_RUN);
+		bench_scan("scan_iq_capture_corr", cap, caplen, MODE_CORR);
+		free(cap);
+	}
+
+	bench_decode("frame_decode_as", SYNTH_AS, 0);
+	bench_decode("frame_decode_al", SYNTH_AL, 0);
+	bench_decode("frame_decode_up", SYNTH_UP, 0);
+	bench_decode("frame_decode_as_errs", SYNTH_AS, code_as.nroots / 4);
+	bench_decode("frame_decode_al_errs", SYNTH_AL, code_al.nroots / 4);
+	bench_decode("frame_decode_up_errs", SYNTH_UP, code_up.nroots / 4);
+	bench_fec();
+
+	writer_fini(&out_w);
+	close(fd);
+	free(noise);
+	free(traffic);
+	return 0;
+}
+
+/*
+ * The lookup of the phase alone, which used to be to_phi().
+ */
+static void bench_phi(const unsigned char *buf, size_t len)
+{
+	struct bench b;
+	unsigned int sum = 0;
+	size_t x;
+
+	bench_begin(&b, "iq_to_phi");
+	while (bench_more(&b)) {
+		for (x = 0; x + 1 < len; x += 2)
+			sum += iq_to_phi[buf[x]][buf[x + 1]];
+		b.samples += len / 2;
+	}
+	bench_end(&b);
+	if (sum == 1)
+		printf("\n");	/* so that the loop is not optimized out */
+}
+
+/*
+ * The slicer, the sync, and, with traffic, the decoding and the printing
+ * of the frames that it finds, all in this thread.
+ */
+static void bench_scan(const char *name, const unsigned char *buf,
+    size_t len, int mode)
+{
+	struct bench b;
+	struct slicer sl;
+	struct ss_stat st;
+	size_t off, n;
+
+	par.mode = mode;
+	slicer_init(&sl);
+	memset(&st, 0, sizeof(st));
+	bench_begin(&b, name);
+	while (bench_more(&b)) {
+		for (off = 0; off < len; off += n) {
+			n = (len - off < BENCH_CHUNK) ? len - off : BENCH_CHUNK;
+			scan_iq(&sl, &st, buf + off, n);
+		}
+	}
+	b.samples = st.samples;
+	bench_end(&b);
+	free(sl.phase[0].bits);
+	free(sl.phase[0].conf);
+	free(sl.phase[1].bits);
+	free(sl.phase[1].conf);
+	par.mode = MODE_RUN;
+}
+
+/*
+ * Decode frames as the slicer gives them, clean, or with nerrs bytes
+ * wrong in every codeword. The bits of the errors are the least reliable,
+ * so the erasures come into play as they would.
+ */
+static void bench_decode(const char *name, int kind, int nerrs)
+{
+	static struct frame tmpl[BENCH_FRAMES];
+	static unsigned char sent[BENCH_FRAMES][6*92];
+	struct synth_conf yconf;
+	struct synth synth;
+	struct synth_burst burst;
+	struct frame *fp;
+	struct bench b;
+	int len, ncw, i, k, j;
+
+	memset(&yconf, 0, sizeof(yconf));
+	yconf.rate = UAT_RATE;
+	if (synth_init(&synth, &yconf) != 0)
+		exit(1);
+	ncw = (kind == SYNTH_UP) ? 6 : 1;
+	for (i = 0; i < BENCH_FRAMES; i++) {
+		fp = &tmpl[i];
+		memset(fp, 0, sizeof(struct frame));
+		len = synth_packet(&synth, kind, sent[i], &burst);
+		fp->nbits = len * 8;
+		memcpy(fp->data, sent[i], len);
+		memset(fp->rel, 255, len);
+		for (k = 0; k < nerrs * ncw; k++) {
+			j = (k * 37 + i) % len;
+			fp->data[j] ^= 0x5a;
+			fp->rel[j] = 10;
+		}
+	}
+	synth_fini(&synth);
+
+	bench_begin(&b, name);
+	while (bench_more(&b)) {
+		for (i = 0; i < BENCH_FRAMES; i++) {
+			static struct frame f;
+
+			fp = &tmpl[i];
+			f.nbits = fp->nbits;
+			memcpy(f.data, fp->data, fp->nbits/8);
+			memcpy(f.rel, fp->rel, fp->nbits/8);
+			f.bad = 0;
+			f.fixed = 0;
+			frame_decode(&f);
+			if (f.bad != 0 || (kind != SYNTH_UP &&
+			    memcmp(f.data, sent[i], f.nbits/8) != 0)) {
+				fprintf(stderr, TAG ": %s: frame %d is bad\n",
+				    name, i);
+				exit(1);
+			}
+		}
+		b.codewords += BENCH_FRAMES * ncw;
+	}
+	bench_end(&b);
+}
+
+static void bench_fec(void)
+{
+	unsigned char msg[BENCH_FRAMES][92], rem[20];
+	struct synth_burst burst;
+	struct synth_conf yconf;
+	struct synth synth;
+	unsigned int a, c, sum;
+	struct bench b;
+	int i;
+
+	memset(&yconf, 0, sizeof(yconf));
+	yconf.rate = UAT_RATE;
+	if (synth_init(&synth, &yconf) != 0)
+		exit(1);
+	for (i = 0; i < BENCH_FRAMES; i++) {
+		unsigned char frame[6*92];
+
+		synth_packet(&synth, SYNTH_UP, frame, &burst);
+		memcpy(msg[i], burst.data, 72);
+	}
+	synth_fini(&synth);
+
+	bench_begin(&b, "p_rem_up");
+	while (bench_more(&b)) {
+		for (i = 0; i < BENCH_FRAMES; i++)
+			p_rem(&gf_uat, rem, 20, 72, msg[i], gpoly_uat_up);
+		b.codewords += BENCH_FRAMES;
+	}
+	bench_end(&b);
+
+	bench_begin(&b, "rs_rem_up");
+	while (bench_more(&b)) {
+		for (i = 0; i < BENCH_FRAMES; i++)
+			rs_rem(&code_up, rem, 72, msg[i]);
+		b.codewords += BENCH_FRAMES;
+	}
+	bench_end(&b);
+
+	sum = 0;
+	bench_begin(&b, "gf_mult");
+	while (bench_more(&b)) {
+		for (a = 0; a < 256; a++) {
+			for (c = 0; c < 256; c++)
+				sum ^= gf_mult(&gf_uat, a, c ^ sum);
+		}
+		b.ops += 256 * 256;
+	}
+	bench_end(&b);
+	if (sum == 256)
+		printf("\n");	/* so that the loop is not optimized out */
+}
+
+/*
+ * BENCH_SAMPLES of noise at the level of the synthesizer, with one burst
+ * in every slot if asked, which is more than any station has.
+ */
+static unsigned char *bench_signal(double snr, int bursts)
+{
+	struct synth_conf yconf;
+	struct synth synth;
+	unsigned char *buf;
+
+	if ((buf = malloc(BENCH_SAMPLES * 2)) == NULL) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+	memset(&yconf, 0, sizeof(yconf));
+	yconf.format = SYNTH_CU8;
+	yconf.rate = UAT_RATE;
+	yconf.snr = snr;
+	if (synth_init(&synth, &yconf) != 0)
+		exit(1);
+	synth.limit = bursts ? BENCH_SAMPLES : 1;
+	synth_gen(&synth, buf, BENCH_SAMPLES);
+	synth_fini(&synth);
+	return buf;
+}
+
+static unsigned char *bench_capture(const char *path, size_t *lenp)
+{
+	unsigned char *buf;
+	size_t size, len;
+	FILE *fp;
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		fprintf(stderr, TAG ": %s: %s\n", path, strerror(errno));
+		exit(1);
+	}
+	/* Up to 64 MB, the rest would only make it longer */
+	size = 64*1024*1024;
+	if ((buf = malloc(size)) == NULL) {
+		fprintf(stderr, TAG ": No core\n");
+		exit(1);
+	}
+	len = fread(buf, 1, size, fp) & ~1;
+	fclose(fp);
+	if (len == 0) {
+		fprintf(stderr, TAG ": %s: No samples\n", path);
+		exit(1);
+	}
+	*lenp = len;
+	return buf;
+}
+
+static void bench_usage(void)
+{
+	fprintf(stderr, "Usage: " TAG " [-t seconds] [-f capture.cu8]\n");
+	exit(1);
+}
@@ -4,10 +4,27 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GF_X86 1
+#endif
+
 #include "fec.h"
 
 static int gen256(unsigned char dst[256], unsigned int prim_poly);
-static int genx(unsigned char dst[256], unsigned char field[256]);
+static int genx(unsigned char dst[256], const unsigned char field[256]);
+static void genexp(unsigned char exp[GF_EXP_LEN], unsigned short log[256],
+    const unsigned char field[256]);
+static void gennib(unsigned char (*nib)[32], const struct gf *f);
+static void rs_rem_lfsr(const struct rs_code *rc, unsigned char *rem,
+    int alen, const unsigned char *pa);
+static int rs_correct(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *synd, const int *eras, int neras);
+static int rs_correct_soft(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *synd, const unsigned char *rel, int stride,
+    int maxeras);
+static int synd_scalar(const struct rs_code *rc, unsigned char *synd,
+    const unsigned char *cw, int early);
 
 /*
  * gf_init: construct the GF(256) field and its index
@@ -23,43 +40,63 @@ static int genx(unsigned char dst[256], unsigned char field[256]);
 int gf_init(struct gf *f, unsigned short prim_poly)
 {
 	unsigned char *p;
+	unsigned char *field, *index, *exp;
+	unsigned short *log;
+	unsigned char (*nib)[32];
 	int ret;
 
+	/*
+	 * One block for all tables, the largest first to keep the alignment.
+	 */
 	ret = -1;
-	p = malloc(256);
+	p = malloc(256*32 + GF_EXP_LEN + 256*sizeof(unsigned short) +
+	    256 + 256);
 	if (!p)
-		goto no_core_1;
-	f->field = p;
-	p = malloc(256);
-	if (!p)
-		goto no_core_2;
-	f->index = p;
+		goto no_core;
+	f->mem = p;
+	nib = (unsigned char (*)[32]) p;
+	p += 256*32;
+	exp = p;
+	p += GF_EXP_LEN;
+	log = (unsigned short *) p;
+	p += 256*sizeof(unsigned short);
+	field = p;
+	p += 256;
+	index = p;
 
-	if (gen256(f->field, prim_poly) != 0) {
+	if (gen256(field, prim_poly) != 0) {
 		ret = -2;
 		goto err_gen256;
 	}
 
-	if (genx(f->index, f->field) != 0) {
+	if (genx(index, field) != 0) {
 		ret = -3;
 		goto err_genx;
 	}
 
+	genexp(exp, log, field);
+
+	f->field = field;
+	f->index = index;
+	f->exp = exp;
+	f->log = log;
+	gennib(nib, f);
+	f->nib = (const unsigned char (*)[32]) nib;
+
+	/* The first field selects the kernels, unless the caller did. */
+	gf_simd(-2);
 	return 0;
 
 err_genx:
 err_gen256:
-	free(f->index);
-no_core_2:
-	free (f->field);
-no_core_1:
+	free(f->mem);
+no_core:
 	return ret;
 }
 
 void gf_fin(struct gf *f)
 {
-	free(f->index);
-	free(f->field);
+	free(f->mem);
 }
 
 /*
@@ -128,7 +165,7 @@ static int gen256(unsigned char dst[256], unsigned int prim_poly)
  *
  * Returns true if unique, false otherwise.
  */
-static int genx(unsigned char dst[256], unsigned char field[256])
+static int genx(unsigned char dst[256], const unsigned char field[256])
 {
 	int error = 0;
 	short int index[256];	/* indices (or alpha power + 1) by element */
@@ -163,28 +200,416 @@ static int genx(unsigned char dst[256], unsigned char field[256])
 	return (error == 0)? 0: -1;
 }
 
+/*
+ * The exp[] is alpha^i for i in 0..509, so that a sum of two powers needs
+ * no modulo, followed by zeroes. The log[] of zero points at the zeroes,
+ * so that gf_mult() needs no test for zero either.
+ */
+static void genexp(unsigned char exp[GF_EXP_LEN], unsigned short log[256],
+    const unsigned char field[256])
+{
+	int i;
+
+	for (i = 0; i < GF_EXP_LEN; i++)
+		exp[i] = (i < 2*255) ? field[i % 255 + 1] : 0;
+	log[0] = GF_LOG_ZERO;
+	for (i = 0; i < 255; i++)
+		log[field[i + 1]] = i;
+}
+
+static void gennib(unsigned char (*nib)[32], const struct gf *f)
+{
+	unsigned int c, x;
+
+	for (c = 0; c < 256; c++) {
+		for (x = 0; x < 16; x++) {
+			nib[c][x] = gf_mult(f, c, x);
+			nib[c][16 + x] = gf_mult(f, c, x << 4);
+		}
+	}
+}
+
 /*
  * Both a and b are in binary (tuple) representation, of course.
  */
-unsigned int gf_add(struct gf *f, unsigned int a, unsigned int b)
+unsigned int gf_add(const struct gf *f, unsigned int a, unsigned int b)
 {
 	return a ^ b;
 }
 
-unsigned int gf_mult(struct gf *f, unsigned int a, unsigned int b)
+unsigned int gf_mult(const struct gf *f, unsigned int a, unsigned int b)
 {
-	unsigned int a_power, b_power, sum_power;
+	return f->exp[f->log[a & 0xff] + f->log[b & 0xff]];
+}
 
-	if (a == 0 || b == 0)
-		return 0;
-	a_power = f->index[a] - 1;
-	b_power = f->index[b] - 1;
+/*
+ * The SIMD kernels. Multiplication by a constant c is linear over GF(2),
+ * so c*x == c*(x & 0xf) + c*(x & 0xf0), and each half is a lookup
+ * in a 16-entry table, which is what PSHUFB does for 16 or 32 bytes
+ * at once. The tables are in f->nib[c], so any field works.
+ *
+ * There are three kernels:
+ *   mul_add: dst[0..len) += c * src[0..len), a row scaled by a constant
+ *   dot32: acc[0..32) = sum over i of coef[i] * rows[i][0..32)
+ *   dot32_ilv: same as dot32 for several interleaved codewords, so
+ *     acc[b*32..b*32+32) = sum over i of coef[i*lanes + b] * rows[i]
+ * The dot32 is how we compute syndromes and parity: each symbol of the
+ * codeword scales a precomputed row, and the rows are summed.
+ */
+struct gf_kern {
+	void (*mul_add)(const unsigned char (*nib)[32], unsigned char *dst,
+	    const unsigned char *src, unsigned int c, int len);
+	void (*dot32)(const unsigned char (*nib)[32], unsigned char *acc,
+	    const unsigned char *coef, int cnt,
+	    const unsigned char (*rows)[32]);
+	void (*dot32_ilv)(const unsigned char (*nib)[32], unsigned char *acc,
+	    const unsigned char *coef, int lanes, int cnt,
+	    const unsigned char (*rows)[32]);
+};
+
+static void mul_add_scalar(const unsigned char (*nib)[32], unsigned char *dst,
+    const unsigned char *src, unsigned int c, int len)
+{
+	const unsigned char *t = nib[c];
+	int i;
+
+	for (i = 0; i < len; i++)
+		dst[i] ^= t[src[i] & 0xf] ^ t[16 + (src[i] >> 4)];
+}
+
+static void dot32_scalar(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int cnt, const unsigned char (*rows)[32])
+{
+	int i;
+
+	memset(acc, 0, 32);
+	for (i = 0; i < cnt; i++) {
+		if (coef[i] != 0)
+			mul_add_scalar(nib, acc, rows[i], coef[i], 32);
+	}
+}
+
+static void dot32_ilv_scalar(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int lanes, int cnt,
+    const unsigned char (*rows)[32])
+{
+	unsigned int c;
+	int i, b;
+
+	memset(acc, 0, lanes * 32);
+	for (i = 0; i < cnt; i++) {
+		for (b = 0; b < lanes; b++) {
+			if ((c = coef[i*lanes + b]) != 0)
+				mul_add_scalar(nib, acc + b*32, rows[i], c, 32);
+		}
+	}
+}
+
+#ifdef GF_X86
+__attribute__((target("ssse3")))
+static void mul_add_ssse3(const unsigned char (*nib)[32], unsigned char *dst,
+    const unsigned char *src, unsigned int c, int len)
+{
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	__m128i tlo, thi, v, d;
+	int i;
 
-	sum_power = a_power + b_power;
-	if (sum_power < 255)
-		return f->field[sum_power + 1];
-	sum_power -= 255;
-	return f->field[sum_power + 1];
+	tlo = _mm_loadu_si128((const __m128i *) nib[c]);
+	thi = _mm_loadu_si128((const __m128i *) (nib[c] + 16));
+	for (i = 0; i + 16 <= len; i += 16) {
+		v = _mm_loadu_si128((const __m128i *) (src + i));
+		d = _mm_loadu_si128((const __m128i *) (dst + i));
+		d = _mm_xor_si128(d,
+		    _mm_shuffle_epi8(tlo, _mm_and_si128(v, mask)));
+		d = _mm_xor_si128(d, _mm_shuffle_epi8(thi,
+		    _mm_and_si128(_mm_srli_epi64(v, 4), mask)));
+		_mm_storeu_si128((__m128i *) (dst + i), d);
+	}
+	mul_add_scalar(nib, dst + i, src + i, c, len - i);
+}
+
+__attribute__((target("ssse3")))
+static void dot32_ssse3(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int cnt, const unsigned char (*rows)[32])
+{
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	__m128i a0, a1, tlo, thi, v;
+	unsigned int c;
+	int i;
+
+	a0 = _mm_setzero_si128();
+	a1 = _mm_setzero_si128();
+	for (i = 0; i < cnt; i++) {
+		/* Uplinks are full of zeros, so this pays for the branch. */
+		if ((c = coef[i]) == 0)
+			continue;
+		tlo = _mm_loadu_si128((const __m128i *) nib[c]);
+		thi = _mm_loadu_si128((const __m128i *) (nib[c] + 16));
+
+		v = _mm_loadu_si128((const __m128i *) rows[i]);
+		a0 = _mm_xor_si128(a0,
+		    _mm_shuffle_epi8(tlo, _mm_and_si128(v, mask)));
+		a0 = _mm_xor_si128(a0, _mm_shuffle_epi8(thi,
+		    _mm_and_si128(_mm_srli_epi64(v, 4), mask)));
+
+		v = _mm_loadu_si128((const __m128i *) (rows[i] + 16));
+		a1 = _mm_xor_si128(a1,
+		    _mm_shuffle_epi8(tlo, _mm_and_si128(v, mask)));
+		a1 = _mm_xor_si128(a1, _mm_shuffle_epi8(thi,
+		    _mm_and_si128(_mm_srli_epi64(v, 4), mask)));
+	}
+	_mm_storeu_si128((__m128i *) acc, a0);
+	_mm_storeu_si128((__m128i *) (acc + 16), a1);
+}
+
+/*
+ * The interleaved kernels split the row into nibbles once, and then
+ * every lane only needs to load its own tables.
+ */
+__attribute__((target("ssse3")))
+static void dot32_ilv_ssse3(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int lanes, int cnt,
+    const unsigned char (*rows)[32])
+{
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	__m128i a[RS_MAXLANES][2];
+	__m128i lo0, hi0, lo1, hi1, tlo, thi, v;
+	unsigned int c;
+	int i, b;
+
+	for (b = 0; b < lanes; b++) {
+		a[b][0] = _mm_setzero_si128();
+		a[b][1] = _mm_setzero_si128();
+	}
+	for (i = 0; i < cnt; i++) {
+		v = _mm_loadu_si128((const __m128i *) rows[i]);
+		lo0 = _mm_and_si128(v, mask);
+		hi0 = _mm_and_si128(_mm_srli_epi64(v, 4), mask);
+		v = _mm_loadu_si128((const __m128i *) (rows[i] + 16));
+		lo1 = _mm_and_si128(v, mask);
+		hi1 = _mm_and_si128(_mm_srli_epi64(v, 4), mask);
+		for (b = 0; b < lanes; b++) {
+			if ((c = coef[i*lanes + b]) == 0)
+				continue;
+			tlo = _mm_loadu_si128((const __m128i *) nib[c]);
+			thi = _mm_loadu_si128((const __m128i *) (nib[c] + 16));
+			a[b][0] = _mm_xor_si128(a[b][0], _mm_xor_si128(
+			    _mm_shuffle_epi8(tlo, lo0),
+			    _mm_shuffle_epi8(thi, hi0)));
+			a[b][1] = _mm_xor_si128(a[b][1], _mm_xor_si128(
+			    _mm_shuffle_epi8(tlo, lo1),
+			    _mm_shuffle_epi8(thi, hi1)));
+		}
+	}
+	for (b = 0; b < lanes; b++) {
+		_mm_storeu_si128((__m128i *) (acc + b*32), a[b][0]);
+		_mm_storeu_si128((__m128i *) (acc + b*32 + 16), a[b][1]);
+	}
+}
+
+__attribute__((target("avx2")))
+static void mul_add_avx2(const unsigned char (*nib)[32], unsigned char *dst,
+    const unsigned char *src, unsigned int c, int len)
+{
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+	__m256i tlo, thi, v, d;
+	int i;
+
+	tlo = _mm256_broadcastsi128_si256(
+	    _mm_loadu_si128((const __m128i *) nib[c]));
+	thi = _mm256_broadcastsi128_si256(
+	    _mm_loadu_si128((const __m128i *) (nib[c] + 16)));
+	for (i = 0; i + 32 <= len; i += 32) {
+		v = _mm256_loadu_si256((const __m256i *) (src + i));
+		d = _mm256_loadu_si256((const __m256i *) (dst + i));
+		d = _mm256_xor_si256(d,
+		    _mm256_shuffle_epi8(tlo, _mm256_and_si256(v, mask)));
+		d = _mm256_xor_si256(d, _mm256_shuffle_epi8(thi,
+		    _mm256_and_si256(_mm256_srli_epi64(v, 4), mask)));
+		_mm256_storeu_si256((__m256i *) (dst + i), d);
+	}
+	/*
+	 * Not calling mul_add_ssse3() for the tail, because switching
+	 * from VEX to legacy SSE encoding costs a lot on some CPUs.
+	 */
+	if (i + 16 <= len) {
+		__m128i v1, d1;
+		const __m128i mask1 = _mm_set1_epi8(0x0f);
+
+		v1 = _mm_loadu_si128((const __m128i *) (src + i));
+		d1 = _mm_loadu_si128((const __m128i *) (dst + i));
+		d1 = _mm_xor_si128(d1, _mm_shuffle_epi8(
+		    _mm256_castsi256_si128(tlo), _mm_and_si128(v1, mask1)));
+		d1 = _mm_xor_si128(d1, _mm_shuffle_epi8(
+		    _mm256_castsi256_si128(thi),
+		    _mm_and_si128(_mm_srli_epi64(v1, 4), mask1)));
+		_mm_storeu_si128((__m128i *) (dst + i), d1);
+		i += 16;
+	}
+	mul_add_scalar(nib, dst + i, src + i, c, len - i);
+}
+
+__attribute__((target("avx2")))
+static void dot32_avx2(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int cnt, const unsigned char (*rows)[32])
+{
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+	__m256i a, tlo, thi, v;
+	unsigned int c;
+	int i;
+
+	a = _mm256_setzero_si256();
+	for (i = 0; i < cnt; i++) {
+		if ((c = coef[i]) == 0)
+			continue;
+		tlo = _mm256_broadcastsi128_si256(
+		    _mm_loadu_si128((const __m128i *) nib[c]));
+		thi = _mm256_broadcastsi128_si256(
+		    _mm_loadu_si128((const __m128i *) (nib[c] + 16)));
+		v = _mm256_loadu_si256((const __m256i *) rows[i]);
+		a = _mm256_xor_si256(a,
+		    _mm256_shuffle_epi8(tlo, _mm256_and_si256(v, mask)));
+		a = _mm256_xor_si256(a, _mm256_shuffle_epi8(thi,
+		    _mm256_and_si256(_mm256_srli_epi64(v, 4), mask)));
+	}
+	_mm256_storeu_si256((__m256i *) acc, a);
+}
+
+__attribute__((target("avx2")))
+static void dot32_ilv_avx2(const unsigned char (*nib)[32], unsigned char *acc,
+    const unsigned char *coef, int lanes, int cnt,
+    const unsigned char (*rows)[32])
+{
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+	__m256i a[RS_MAXLANES];
+	__m256i lo, hi, tlo, thi, v;
+	unsigned int c;
+	int i, b;
+
+	for (b = 0; b < lanes; b++)
+		a[b] = _mm256_setzero_si256();
+	for (i = 0; i < cnt; i++) {
+		v = _mm256_loadu_si256((const __m256i *) rows[i]);
+		lo = _mm256_and_si256(v, mask);
+		hi = _mm256_and_si256(_mm256_srli_epi64(v, 4), mask);
+		for (b = 0; b < lanes; b++) {
+			if ((c = coef[i*lanes + b]) == 0)
+				continue;
+			tlo = _mm256_broadcastsi128_si256(
+			    _mm_loadu_si128((const __m128i *) nib[c]));
+			thi = _mm256_broadcastsi128_si256(
+			    _mm_loadu_si128((const __m128i *) (nib[c] + 16)));
+			a[b] = _mm256_xor_si256(a[b], _mm256_xor_si256(
+			    _mm256_shuffle_epi8(tlo, lo),
+			    _mm256_shuffle_epi8(thi, hi)));
+		}
+	}
+	for (b = 0; b < lanes; b++)
+		_mm256_storeu_si256((__m256i *) (acc + b*32), a[b]);
+}
+
+/*
+ * Deinterleave 6 codewords, 8 symbols of each at a time. The 48 bytes
+ * of input are 3 registers, and each lane collects its 8 bytes from all
+ * three with PSHUFB, using the masks that gf_simd() prepares.
+ * Returns the number of symbols done, the caller finishes the tail.
+ */
+static unsigned char ilv6_mask[6][3][16];
+
+__attribute__((target("ssse3")))
+static int deinterleave6_ssse3(unsigned char *out, const unsigned char *ilv,
+    int n)
+{
+	__m128i v0, v1, v2, d;
+	int i, b;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		v0 = _mm_loadu_si128((const __m128i *) (ilv + i*6));
+		v1 = _mm_loadu_si128((const __m128i *) (ilv + i*6 + 16));
+		v2 = _mm_loadu_si128((const __m128i *) (ilv + i*6 + 32));
+		for (b = 0; b < 6; b++) {
+			d = _mm_shuffle_epi8(v0,
+			    _mm_loadu_si128((const __m128i *) ilv6_mask[b][0]));
+			d = _mm_or_si128(d, _mm_shuffle_epi8(v1,
+			    _mm_loadu_si128((const __m128i *) ilv6_mask[b][1])));
+			d = _mm_or_si128(d, _mm_shuffle_epi8(v2,
+			    _mm_loadu_si128((const __m128i *) ilv6_mask[b][2])));
+			_mm_storel_epi64((__m128i *) (out + b*n + i), d);
+		}
+	}
+	return i;
+}
+#endif /* GF_X86 */
+
+static const struct gf_kern kern_tab[] = {
+	[GF_SIMD_NONE] = { mul_add_scalar, dot32_scalar, dot32_ilv_scalar },
+#ifdef GF_X86
+	[GF_SIMD_SSSE3] = { mul_add_ssse3, dot32_ssse3, dot32_ilv_ssse3 },
+	[GF_SIMD_AVX2] = { mul_add_avx2, dot32_avx2, dot32_ilv_avx2 },
+#endif
+};
+
+static int gf_level = -1;
+static const struct gf_kern *gf_kern = &kern_tab[GF_SIMD_NONE];
+
+/*
+ * Select the kernels.
+ *
+ *   level: one of GF_SIMD_xxx, or -1 for the best that the CPU has
+ *   return: the level actually in effect, which may be lower than asked
+ *
+ * The gf_init() calls this with -2, which means "-1 unless already set".
+ * Since the selection is global, call it before starting any threads.
+ */
+int gf_simd(int level)
+{
+	int best;
+
+	if (level == -2) {
+		if (gf_level != -1)
+			return gf_level;
+		level = -1;
+	}
+
+	best = GF_SIMD_NONE;
+#ifdef GF_X86
+	{
+		int b, k, r, x;
+
+		for (b = 0; b < 6; b++) {
+			for (k = 0; k < 3; k++) {
+				for (r = 0; r < 16; r++) {
+					x = 6*r + b - 16*k;
+					ilv6_mask[b][k][r] =
+					    (r < 8 && x >= 0 && x < 16) ?
+					    x : 0x80;
+				}
+			}
+		}
+	}
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("ssse3"))
+		best = GF_SIMD_SSSE3;
+	if (__builtin_cpu_supports("avx2"))
+		best = GF_SIMD_AVX2;
+#endif
+	if (level < 0 || level > best)
+		level = best;
+
+	gf_level = level;
+	gf_kern = &kern_tab[level];
+	return level;
+}
+
+/*
+ * Multiply the src[len] by a constant c and add it to dst[len].
+ */
+void gf_mul_add(const struct gf *f, unsigned char *dst,
+    const unsigned char *src, unsigned int c, int len)
+{
+	if (c == 0)
+		return;
+	(*gf_kern->mul_add)(f->nib, dst, src, c, len);
 }
 
 /*
@@ -197,7 +622,8 @@ unsigned int gf_mult(struct gf *f, unsigned int a, unsigned int b)
  *   start_power: power of first root - may be 0
  *   end_power: power of last root
  */
-int p_gen_gen(struct gf *f, unsigned char *dst, int start_power, int end_power)
+int p_gen_gen(const struct gf *f, unsigned char *dst,
+    int start_power, int end_power)
 {
 	int i, j;
 	unsigned char arg1[255];
@@ -245,20 +671,15 @@ int p_gen_gen(struct gf *f, unsigned char *dst, int start_power, int end_power)
  *   pa: polynomial a with max power of X ^ (alen-1) at pa[0]
  *   pb: polynomial a with max power of X ^ (blen-1) at pb[0]
  */
-void p_mul(struct gf *f, unsigned char *dst,
+void p_mul(const struct gf *f, unsigned char *dst,
     int alen, unsigned char *pa, int blen, unsigned char *pb)
 {
-	int i, j;
-	unsigned char pm;
+	int i;
 
 	for (i = 0; i < alen+blen-1; i++)
 		dst[i] = 0;
-	for (i = 0; i < alen; i++) {
-		for (j = 0; j < blen; j++) {
-			pm = gf_mult(f, pa[i], pb[j]);
-			dst[i+j] = gf_add(f, dst[i+j], pm);
-		}
-	}
+	for (i = 0; i < alen; i++)
+		gf_mul_add(f, dst + i, pb, pa[i], blen);
 }
 
 /*
@@ -267,23 +688,17 @@ void p_mul(struct gf *f, unsigned char *dst,
  * This function uses the same representation that we use above,
  * with X^(len-1) being the leftmost (array index 0).
  */
-void p_rem(struct gf *f, unsigned char *rem, int len,
+void p_rem(const struct gf *f, unsigned char *rem, int len,
     int alen, const unsigned char *pa, const unsigned char *div)
 {
 	int l;
-	int i, j;
-	unsigned char *accum;
+	int i;
 	unsigned char rem_0;
 
 	/* It's redundant to carry this 1, yes, but c'est la vie. */
 	if (div[0] != 1)
 		abort();
 
-	/* It's either this, limit len, or GNU alloca() - pick your poison. */
-	accum = malloc(len+1);
-	if (!accum)
-		abort();
-
 	l = (len < alen) ? len : alen;
 	memcpy(rem, pa, l);
 	if (l < len)
@@ -294,20 +709,575 @@ void p_rem(struct gf *f, unsigned char *rem, int len,
 		memmove(rem, rem+1, len-1);
 		rem[len-1] = (i < alen) ? pa[i] : 0;
 
-		for (j = 0; j < len+1; j++) {
-			accum[j] = gf_mult(f, div[j], rem_0);
-		}
 		/*
-		 * At this point, accum[0] is always the same as rem_0,
+		 * The product of div[0] and rem_0 is always the same as rem_0,
 		 * because div[0] is always 1. If we subtracted them,
 		 * we would get zero. So we skip that.
 		 */
+		gf_mul_add(f, rem, div + 1, rem_0, len);
+	}
+}
+
+/*
+ * Multiply a by alpha^e, where e is any non-negative power.
+ */
+static unsigned int gf_mult_exp(const struct gf *f, unsigned int a,
+    unsigned int e)
+{
+	unsigned int p;
+
+	if (a == 0)
+		return 0;
+	p = (f->index[a] - 1 + e) % 255;
+	return f->field[p + 1];
+}
+
+static unsigned int gf_inv(const struct gf *f, unsigned int a)
+{
+	unsigned int p;
+
+	/* Nobody is supposed to divide by zero, so it is not checked. */
+	p = f->index[a] - 1;
+	return f->field[(255 - p) % 255 + 1];
+}
+
+/*
+ * Set up a Reed-Solomon code. The code keeps pointers to the field
+ * and the generator polynomial, so both must outlive it. We also
+ * precompute tables for multiplication by each root, so that the syndromes
+ * can be computed without any arithmetic in the index domain, and the
+ * products of the whole generator by every element, for the remainder.
+ *
+ *   rc: the code to fill
+ *   f: pointer to the field
+ *   gpoly: generator polynomial of nroots+1 coefficients, as p_gen_gen()
+ *   n: length of the codeword, including parity
+ *   nroots: number of roots of gpoly, same as the number of parity symbols
+ *   fcr: power of the first root, e.g. 120 for UAT
+ */
+int rs_code_init(struct rs_code *rc, const struct gf *f,
+    const unsigned char *gpoly, int n, int nroots, int fcr)
+{
+	unsigned char unit[255];
+	unsigned int r;
+	int i, j, s;
+
+	if (nroots <= 0 || nroots > RS_MAXROOTS ||
+	    n <= nroots || n > 255 ||
+	    fcr < 0 || fcr >= 255)
+		return -1;
+	if (gpoly[0] != 1)
+		return -1;
+
+	rc->f = f;
+	rc->gpoly = gpoly;
+	rc->n = n;
+	rc->nroots = nroots;
+	rc->fcr = fcr;
+
+	rc->rtab = malloc(nroots * 256);
+	if (!rc->rtab)
+		return -1;
+	for (j = 0; j < nroots; j++) {
+		r = (fcr + j) % 255;
+		for (s = 0; s < 256; s++)
+			rc->rtab[j][s] = gf_mult_exp(f, s, r);
+	}
 
-		for (j = 0; j < len; j++) {
-			rem[j] = gf_add(f, accum[j + 1], rem[j]);
+	rc->gtab = malloc(256 * RS_MAXROOTS);
+	if (!rc->gtab) {
+		free(rc->rtab);
+		return -1;
+	}
+	for (s = 0; s < 256; s++) {
+		for (j = 0; j < RS_MAXROOTS; j++) {
+			rc->gtab[s][j] = (j < nroots) ?
+			    gf_mult(f, s, gpoly[j+1]) : 0;
+		}
+	}
+
+	/*
+	 * The syndrome j is the sum of cw[i] * (alpha^(fcr+j))^(n-1-i), and
+	 * the parity is the sum of cw[i] * (X^(n-1-i) mod g(x)) over the data.
+	 * So, both are computed by dot32 from these rows.
+	 */
+	rc->srow = malloc(n * RS_MAXROOTS);
+	rc->prow = malloc(n * RS_MAXROOTS);
+	if (!rc->srow || !rc->prow) {
+		free(rc->prow);
+		free(rc->srow);
+		free(rc->gtab);
+		free(rc->rtab);
+		return -1;
+	}
+	memset(rc->srow, 0, n * RS_MAXROOTS);
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < nroots; j++) {
+			r = ((fcr + j) % 255) * (n-1 - i);
+			rc->srow[i][j] = gf_mult_exp(f, 1, r % 255);
+		}
+	}
+	memset(rc->prow, 0, n * RS_MAXROOTS);
+	memset(unit, 0, sizeof(unit));
+	for (i = 0; i < n - nroots; i++) {
+		unit[i] = 1;
+		rs_rem_lfsr(rc, rc->prow[i], n - nroots, unit);
+		unit[i] = 0;
+	}
+	return 0;
+}
+
+void rs_code_fin(struct rs_code *rc)
+{
+	free(rc->prow);
+	rc->prow = NULL;
+	free(rc->srow);
+	rc->srow = NULL;
+	free(rc->gtab);
+	rc->gtab = NULL;
+	free(rc->rtab);
+	rc->rtab = NULL;
+}
+
+/*
+ * Same as p_rem() with the generator of the code as the divisor,
+ * which produces the parity of the message pa[alen].
+ *
+ * With SIMD, the parity is a sum of precomputed rows scaled by the data.
+ * A message shorter than the code is the same as one padded with zeros
+ * at the front, so it simply uses the later rows.
+ */
+void rs_rem(const struct rs_code *rc, unsigned char *rem,
+    int alen, const unsigned char *pa)
+{
+	unsigned char buf[RS_MAXROOTS];
+	int k = rc->n - rc->nroots;
+
+	if (gf_level > GF_SIMD_NONE && alen <= k) {
+		(*gf_kern->dot32)(rc->f->nib, buf, pa, alen, rc->prow + (k-alen));
+		memcpy(rem, buf, rc->nroots);
+		return;
+	}
+	rs_rem_lfsr(rc, rem, alen, pa);
+}
+
+/*
+ * This is the long division done in place in a scratch copy of the
+ * dividend: the leading symbol selects a row of gtab[], which is the
+ * generator pre-multiplied by that symbol, and the row is XOR-ed into
+ * the following symbols. No shifting, no multiplication.
+ */
+static void rs_rem_lfsr(const struct rs_code *rc, unsigned char *rem,
+    int alen, const unsigned char *pa)
+{
+	unsigned char buf[255 + RS_MAXROOTS];
+	const unsigned char *row;
+	int nroots = rc->nroots;
+	int i, j;
+
+	if (alen < 0 || alen + nroots > 255)
+		abort();
+
+	memcpy(buf, pa, alen);
+	memset(buf + alen, 0, RS_MAXROOTS);
+	for (i = 0; i < alen; i++) {
+		row = rc->gtab[buf[i]];
+		/* The row is padded, so a fixed length lets gcc unroll it. */
+		for (j = 0; j < RS_MAXROOTS; j++)
+			buf[i + 1 + j] ^= row[j];
+	}
+	memcpy(rem, buf + alen, nroots);
+}
+
+/*
+ * Check a received codeword without correcting it.
+ *
+ *   rc: the code
+ *   cw: the codeword of rc->n symbols
+ *   return: 0 if the codeword is clean, 1 if it has errors
+ *
+ * This is cheaper than re-encoding the data with p_rem() and comparing
+ * the parity: nothing is allocated, each symbol costs a table lookup
+ * and an XOR per root, and we stop at the first non-zero syndrome.
+ * Damaged codewords usually have S(0) != 0 already.
+ */
+int rs_check(const struct rs_code *rc, const unsigned char *cw)
+{
+	unsigned char synd[RS_MAXROOTS];
+	int j;
+
+	/*
+	 * With SIMD, it's cheaper to compute all the syndromes at once.
+	 * The padding of the rows is zero, and so are the extra syndromes.
+	 */
+	if (gf_level > GF_SIMD_NONE) {
+		(*gf_kern->dot32)(rc->f->nib, synd, cw, rc->n, rc->srow);
+		for (j = 0; j < rc->nroots; j++) {
+			if (synd[j] != 0)
+				return 1;
+		}
+		return 0;
+	}
+	return synd_scalar(rc, synd, cw, 1);
+}
+
+/*
+ * The syndromes without SIMD, by Horner's rule with the tables of roots.
+ *
+ * Each Horner step depends on the previous one, so a single root
+ * is bound by the latency of the lookup. We run 4 roots side by side
+ * to keep the CPU busy. If early is set, we stop after the first group
+ * of 4 that has a non-zero syndrome, and the rest of synd[] is garbage.
+ * The RS(48,34) has 14 roots, so the tail is done by the same loop,
+ * with the missing roots pointing at root j again.
+ */
+static int synd_scalar(const struct rs_code *rc, unsigned char *synd,
+    const unsigned char *cw, int early)
+{
+	const unsigned char *t0, *t1, *t2, *t3;
+	unsigned int s0, s1, s2, s3;
+	unsigned int nz;
+	int nroots = rc->nroots;
+	int i, j;
+
+	nz = 0;
+	for (j = 0; j < nroots; j += 4) {
+		t0 = rc->rtab[j];
+		t1 = (j+1 < nroots) ? rc->rtab[j+1] : t0;
+		t2 = (j+2 < nroots) ? rc->rtab[j+2] : t0;
+		t3 = (j+3 < nroots) ? rc->rtab[j+3] : t0;
+		s0 = s1 = s2 = s3 = 0;
+		for (i = 0; i < rc->n; i++) {
+			s0 = t0[s0] ^ cw[i];
+			s1 = t1[s1] ^ cw[i];
+			s2 = t2[s2] ^ cw[i];
+			s3 = t3[s3] ^ cw[i];
+		}
+		synd[j] = s0;
+		if (j+1 < nroots) synd[j+1] = s1;
+		if (j+2 < nroots) synd[j+2] = s2;
+		if (j+3 < nroots) synd[j+3] = s3;
+		nz |= s0 | s1 | s2 | s3;
+		if (early && nz != 0)
+			break;
+	}
+	return nz != 0;
+}
+
+/*
+ * Compute the syndromes by evaluating the received codeword at every root
+ * of the generator.
+ *
+ * Returns true if any of the syndromes is not zero, that is, the codeword
+ * has errors.
+ */
+static int rs_syndromes(const struct rs_code *rc, unsigned char *synd,
+    const unsigned char *cw)
+{
+	unsigned char buf[RS_MAXROOTS];
+	unsigned int nz;
+	int j;
+
+	if (gf_level > GF_SIMD_NONE) {
+		(*gf_kern->dot32)(rc->f->nib, buf, cw, rc->n, rc->srow);
+		nz = 0;
+		for (j = 0; j < rc->nroots; j++) {
+			synd[j] = buf[j];
+			nz |= buf[j];
+		}
+		return nz != 0;
+	}
+	return synd_scalar(rc, synd, cw, 0);
+}
+
+/*
+ * Correct a received codeword in place.
+ *
+ *   rc: the code
+ *   cw: the codeword of rc->n symbols, data first, parity last
+ *   return: number of corrected symbols, or -1 if the codeword is damaged
+ *     beyond repair, in which case it is left untouched
+ *
+ * This is the textbook decoder: syndromes, Berlekamp-Massey for the error
+ * locator, Chien search for its roots, and Forney for the error values.
+ * A clean codeword only costs the syndrome computation.
+ *
+ * Like everywhere else in this file, the leftmost symbol cw[0] carries
+ * the greatest power, so the symbol at cw[i] is at the power n-1-i.
+ */
+int rs_decode(const struct rs_code *rc, unsigned char *cw)
+{
+	unsigned char synd[RS_MAXROOTS];
+
+	if (!rs_syndromes(rc, synd, cw))
+		return 0;
+	return rs_correct(rc, cw, synd, NULL, 0);
+}
+
+/*
+ * Same as rs_decode(), but if there are too many errors, make use
+ * of the reliability of each symbol, as reported by the demodulator.
+ *
+ *   rel: reliability of every symbol of cw[], the greater the better
+ *   maxeras: the most symbols to erase, up to rc->nroots - 2
+ *
+ * An erasure is an error with a known position, so it only costs one
+ * root instead of two. We erase the least reliable symbols, 2 more at
+ * every attempt, until the codeword decodes. The more we erase, the less
+ * redundancy is left to catch a miscorrection, so maxeras is a trade-off
+ * between the yield and false frames. With nroots erasures, any word at
+ * all would "decode", so at least 2 roots are always left to check.
+ */
+int rs_decode_soft(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *rel, int maxeras)
+{
+	unsigned char synd[RS_MAXROOTS];
+
+	if (!rs_syndromes(rc, synd, cw))
+		return 0;
+	return rs_correct_soft(rc, cw, synd, rel, 1, maxeras);
+}
+
+/*
+ * The rel[] is strided, so that rs_decode_ilv() can pass the reliability
+ * of interleaved symbols without copying it.
+ */
+static int rs_correct_soft(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *synd, const unsigned char *rel, int stride,
+    int maxeras)
+{
+	int eras[RS_MAXROOTS];
+	unsigned char used[255];
+	int neras;
+	int i, x, best;
+	int ret;
+
+	ret = rs_correct(rc, cw, synd, NULL, 0);
+	if (ret >= 0 || rel == NULL)
+		return ret;
+
+	if (maxeras > rc->nroots - 2)
+		maxeras = rc->nroots - 2;
+
+	/* A selection sort is fine, since maxeras is small. */
+	memset(used, 0, rc->n);
+	for (neras = 0; neras < maxeras; neras++) {
+		best = -1;
+		for (i = 0; i < rc->n; i++) {
+			if (used[i])
+				continue;
+			if (best < 0 || rel[i*stride] < rel[best*stride])
+				best = i;
 		}
+		used[best] = 1;
+		eras[neras] = best;
+	}
+
+	for (x = 2; x <= maxeras; x += 2) {
+		ret = rs_correct(rc, cw, synd, eras, x);
+		if (ret >= 0)
+			return ret;
 	}
+	return -1;
+}
+
+/*
+ * The part of rs_decode() after the syndromes are known to be non-zero.
+ *
+ * The eras[neras] are positions in cw[] that are known to be bad. Their
+ * locators seed the lambda(x), and Berlekamp-Massey only needs to find
+ * the rest, so it starts at the step neras.
+ */
+static int rs_correct(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *synd, const int *eras, int neras)
+{
+	const struct gf *f = rc->f;
+	int n = rc->n;
+	int nroots = rc->nroots;
+	unsigned char lambda[RS_MAXROOTS+1], b[RS_MAXROOTS+1], t[RS_MAXROOTS+1];
+	unsigned char omega[RS_MAXROOTS];
+	unsigned char err_pos[RS_MAXROOTS], err_val[RS_MAXROOTS];
+	unsigned int discr, inv;
+	unsigned int q, num, den, xinv;
+	int el, deg_lambda, count, fixed;
+	int r, i, k, p;
 
-	free(accum);
-	return;
+	if (neras > nroots)
+		return -1;
+
+	/* lambda(x) = product of (1 + X*x) over the erasures */
+	memset(lambda, 0, nroots+1);
+	lambda[0] = 1;
+	for (i = 0; i < neras; i++) {
+		p = n-1 - eras[i];
+		for (k = i + 1; k > 0; k--)
+			lambda[k] ^= gf_mult_exp(f, lambda[k-1], p);
+	}
+
+	/*
+	 * Berlekamp-Massey. The b(x) is the correction polynomial,
+	 * which is shifted by x at every step.
+	 */
+	memcpy(b, lambda, nroots+1);
+	el = neras;
+	for (r = neras; r < nroots; r++) {
+		discr = 0;
+		for (i = 0; i <= r; i++)
+			discr ^= gf_mult(f, lambda[i], synd[r - i]);
+
+		memmove(b + 1, b, nroots);
+		b[0] = 0;
+		if (discr == 0)
+			continue;
+
+		for (i = 0; i < nroots+1; i++)
+			t[i] = lambda[i] ^ gf_mult(f, discr, b[i]);
+		if (2*el <= r + neras) {
+			el = r + 1 + neras - el;
+			inv = gf_inv(f, discr);
+			for (i = 0; i < nroots+1; i++)
+				b[i] = gf_mult(f, lambda[i], inv);
+		}
+		memcpy(lambda, t, nroots+1);
+	}
+
+	deg_lambda = 0;
+	for (i = 0; i < nroots+1; i++) {
+		if (lambda[i] != 0)
+			deg_lambda = i;
+	}
+	/* Every error costs 2 roots, and every erasure costs 1. */
+	if (deg_lambda == 0 || 2*deg_lambda - neras > nroots)
+		return -1;
+
+	/* omega(x) = synd(x) * lambda(x) mod x^nroots */
+	for (i = 0; i < nroots; i++) {
+		q = 0;
+		for (k = 0; k <= i && k <= deg_lambda; k++)
+			q ^= gf_mult(f, synd[i - k], lambda[k]);
+		omega[i] = q;
+	}
+
+	/*
+	 * Chien search and Forney. We only look at the positions that
+	 * exist in the shortened code. If lambda has roots elsewhere,
+	 * they are not found, and the count does not match the degree.
+	 */
+	count = 0;
+	for (i = 0; i < n; i++) {
+		p = n-1 - i;
+		xinv = (255 - p) % 255;		/* power of X^-1 */
+
+		q = lambda[0];
+		for (k = 1; k <= deg_lambda; k++)
+			q ^= gf_mult_exp(f, lambda[k], xinv * k);
+		if (q != 0)
+			continue;
+
+		num = 0;
+		for (k = 0; k < nroots; k++)
+			num ^= gf_mult_exp(f, omega[k], xinv * k);
+		/* Formal derivative: only odd powers survive in GF(2^m). */
+		den = 0;
+		for (k = 1; k <= deg_lambda; k += 2)
+			den ^= gf_mult_exp(f, lambda[k], xinv * (k-1));
+		if (den == 0 || count >= deg_lambda)
+			return -1;
+
+		/* Y = X^(1-fcr) * omega(X^-1) / lambda'(X^-1) */
+		q = gf_mult(f, num, gf_inv(f, den));
+		q = gf_mult_exp(f, q, (p * ((256 - rc->fcr) % 255)) % 255);
+		err_pos[count] = i;
+		err_val[count] = q;
+		count++;
+	}
+	if (count != deg_lambda)
+		return -1;
+
+	/* An erased symbol may turn out to be right, so it is not counted. */
+	fixed = 0;
+	for (i = 0; i < count; i++) {
+		if (err_val[i] != 0) {
+			cw[err_pos[i]] ^= err_val[i];
+			fixed++;
+		}
+	}
+	return fixed;
+}
+
+/*
+ * Split lanes codewords of length n, which are interleaved symbol by
+ * symbol, so that the symbol i of codeword b is ilv[i*lanes + b],
+ * into consecutive codewords, so that it is out[b*n + i].
+ */
+void rs_deinterleave(unsigned char *out, const unsigned char *ilv,
+    int n, int lanes)
+{
+	int i, b;
+
+	i = 0;
+#ifdef GF_X86
+	if (lanes == 6 && gf_level > GF_SIMD_NONE)
+		i = deinterleave6_ssse3(out, ilv, n);
+#endif
+	for (; i < n; i++) {
+		for (b = 0; b < lanes; b++)
+			out[b*n + i] = ilv[i*lanes + b];
+	}
+}
+
+/*
+ * Decode several interleaved codewords of the same code, like the 6
+ * blocks of the UAT Uplink.
+ *
+ *   rc: the code
+ *   out: lanes*rc->n symbols, the deinterleaved and corrected codewords
+ *   ilv: the codewords interleaved as received, see rs_deinterleave()
+ *   rel: reliability of every symbol of ilv[], or NULL, see rs_decode_soft()
+ *   maxeras: the most symbols to erase in every codeword
+ *   lanes: the number of codewords, up to RS_MAXLANES
+ *   status: for every codeword, the number of corrected symbols, or -1
+ *   return: the number of codewords that could not be corrected
+ *
+ * The syndromes of all codewords are computed in one pass over ilv[],
+ * in the order it was received, so every row of powers is loaded once
+ * for all lanes. Only the damaged codewords go through the correction.
+ */
+int rs_decode_ilv(const struct rs_code *rc, unsigned char *out,
+    const unsigned char *ilv, const unsigned char *rel, int maxeras,
+    int lanes, int *status)
+{
+	unsigned char synd[RS_MAXLANES * RS_MAXROOTS];
+	unsigned int nz;
+	int bad;
+	int j, b;
+
+	if (lanes <= 0 || lanes > RS_MAXLANES)
+		abort();
+
+	rs_deinterleave(out, ilv, rc->n, lanes);
+	if (gf_level > GF_SIMD_NONE) {
+		(*gf_kern->dot32_ilv)(rc->f->nib, synd, ilv, lanes, rc->n,
+		    rc->srow);
+	} else {
+		/* Without SIMD, the lockstep does not pay, only the tables. */
+		for (b = 0; b < lanes; b++)
+			synd_scalar(rc, synd + b*RS_MAXROOTS, out + b*rc->n, 0);
+	}
+
+	bad = 0;
+	for (b = 0; b < lanes; b++) {
+		nz = 0;
+		for (j = 0; j < rc->nroots; j++)
+			nz |= synd[b*RS_MAXROOTS + j];
+		if (nz == 0) {
+			status[b] = 0;
+			continue;
+		}
+		status[b] = rs_correct_soft(rc, out + b*rc->n,
+		    synd + b*RS_MAXROOTS, rel ? rel + b : NULL, lanes, maxeras);
+		if (status[b] < 0)
+			bad++;
+	}
+	return bad;
 }
@@ -5,18 +5,92 @@
 /*
  * Our field is always the size GF(265), so both field[] and index[] are
  * byte arrays of 265 elements.
+ *
+ * The tables are either built by gf_init(), or made at build time by
+ * gfgen.py, see gf_uat below. Either way, they are read-only once built.
  */
+#define GF_LOG_ZERO  511	/* log[0], lands in the zeroes of exp[] */
+#define GF_EXP_LEN   1024	/* 2*255 powers, then zeroes up to 2*511 */
+
 struct gf {
-	unsigned char *field;	/* "power" representation */
-	unsigned char *index;	/* index of field[] */
+	const unsigned char *field;	/* "power" representation */
+	const unsigned char *index;	/* index of field[] */
+	/*
+	 * Products of every element c by all values of a nibble, low nibble
+	 * first: nib[c][x] = c*x, nib[c][16+x] = c*(x<<4). This is the form
+	 * that the PSHUFB instruction takes as a lookup table.
+	 */
+	const unsigned char (*nib)[32];
+	/* exp[log[a] + log[b]] == a*b, for any a and b, zero included */
+	const unsigned char *exp;
+	const unsigned short *log;
+	void *mem;		/* allocated by gf_init(), NULL if static */
 };
 
+/*
+ * The levels of SIMD, for gf_simd().
+ */
+#define GF_SIMD_NONE   0
+#define GF_SIMD_SSSE3  1
+#define GF_SIMD_AVX2   2
+
 int gf_init(struct gf *f, unsigned short gen_poly);
 void gf_fin(struct gf *f);
-unsigned int gf_add(struct gf *f, unsigned int a, unsigned int b);
-unsigned int gf_mult(struct gf *f, unsigned int a, unsigned int b);
-int p_gen_gen(struct gf *f, unsigned char *dst, int start_power, int end_power);
-void p_mul(struct gf *f, unsigned char *dst,
+int gf_simd(int level);
+unsigned int gf_add(const struct gf *f, unsigned int a, unsigned int b);
+unsigned int gf_mult(const struct gf *f, unsigned int a, unsigned int b);
+void gf_mul_add(const struct gf *f, unsigned char *dst,
+    const unsigned char *src, unsigned int c, int len);
+int p_gen_gen(const struct gf *f, unsigned char *dst,
+    int start_power, int end_power);
+void p_mul(const struct gf *f, unsigned char *dst,
     int alen, unsigned char *pa, int blen, unsigned char *pb);
-void p_rem(struct gf *f, unsigned char *rem, int len,
+void p_rem(const struct gf *f, unsigned char *rem, int len,
     int alen, const unsigned char *pa, const unsigned char *div);
+
+/*
+ * The UAT field (primitive polynomial 0x187) and the generators of its
+ * three codes, roots alpha^120 and up. These live in gftab.c, which gfgen.py
+ * makes at build time, so there's nothing to compute or allocate at startup.
+ * The gf_uat does not select the SIMD kernels, call gf_simd() for that.
+ */
+extern const struct gf gf_uat;
+extern const unsigned char gpoly_uat_up[21];	/* RS(92,72) */
+extern const unsigned char gpoly_uat_as[13];	/* RS(30,18) */
+extern const unsigned char gpoly_uat_al[15];	/* RS(48,34) */
+
+/*
+ * A Reed-Solomon code, possibly shortened. A codeword is n symbols long,
+ * data first, followed by nroots symbols of parity. The generator gpoly[]
+ * has nroots+1 coefficients and its roots are alpha^fcr..alpha^(fcr+nroots-1).
+ */
+#define RS_MAXROOTS  32
+#define RS_MAXLANES  8		/* interleaved codewords, Uplink has 6 */
+
+struct rs_code {
+	const struct gf *f;
+	const unsigned char *gpoly;
+	int n;			/* codeword length, parity included */
+	int nroots;		/* number of parity symbols, 2*t */
+	int fcr;		/* power of alpha of the first root */
+	unsigned char (*rtab)[256];	/* [j][s] = s * alpha^(fcr+j) */
+	unsigned char (*gtab)[RS_MAXROOTS];	/* [s][j] = s * gpoly[j+1] */
+	/* For the SIMD kernels, which sum rows scaled by codeword symbols */
+	unsigned char (*srow)[RS_MAXROOTS];	/* [i][j] = root j ^ (n-1-i) */
+	unsigned char (*prow)[RS_MAXROOTS];	/* [i] = X^(n-1-i) mod gpoly */
+};
+
+int rs_code_init(struct rs_code *rc, const struct gf *f,
+    const unsigned char *gpoly, int n, int nroots, int fcr);
+void rs_code_fin(struct rs_code *rc);
+int rs_check(const struct rs_code *rc, const unsigned char *cw);
+void rs_rem(const struct rs_code *rc, unsigned char *rem,
+    int alen, const unsigned char *pa);
+int rs_decode(const struct rs_code *rc, unsigned char *cw);
+int rs_decode_soft(const struct rs_code *rc, unsigned char *cw,
+    const unsigned char *rel, int maxeras);
+void rs_deinterleave(unsigned char *out, const unsigned char *ilv,
+    int n, int lanes);
+int rs_decode_ilv(const struct rs_code *rc, unsigned char *out,
+    const unsigned char *ilv, const unsigned char *rel, int maxeras,
+    int lanes, int *status);
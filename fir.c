@@ -0,0 +1,336 @@
+/*
+ * The channel filter, see fir.h
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FIR_X86 1
+#endif
+
+#include "fir.h"
+
+#define FIR_RATE    20000000	/* raw samples per second */
+#define FIR_CUTOFF    800000	/* Hz, a little over the half of the channel */
+#define FIR_GAIN           2	/* the mixing leaves a half of the amplitude */
+#define FIR_SHIFT         14	/* the taps are fixed point */
+#define FIR_CLIP        2047	/* what com_tab[] of phasetab.h takes */
+
+static void fir_load16(struct fir *fp, const unsigned char *sp, int n,
+    int bias);
+static void fir_load12(struct fir *fp, const unsigned char *sp, int n,
+    int bias);
+#ifdef FIR_X86
+static int fir_load12_ssse3(short *xe, short *xo, const unsigned char *sp,
+    int n, int bias);
+#endif
+static void fir_dot(const short *xi, const short *xq, const short *ci,
+    const short *cq, int *ip, int *qp);
+
+/*
+ * The prototype is a windowed sinc at FIR_L times the rate, which the
+ * phases take in turn: the tap j of the phase p is the tap p + j*FIR_L,
+ * for the sample j before the last one of the window. The taps are kept
+ * in the order of the samples, with the mixer multiplied in.
+ */
+int fir_init(struct fir *fp, int maxn, int packed)
+{
+	static const int mix[2][4] = { { 1, 0, -1, 0 }, { 0, -1, 0, 1 } };
+	enum { NPROTO = FIR_L * FIR_TAPS };
+	double h[NPROTO];
+	double fc, t, sum;
+	int k, p, i, j, n, iq, off;
+
+	memset(fp, 0, sizeof(struct fir));
+
+	fc = (double) FIR_CUTOFF / (FIR_RATE * FIR_L);
+	sum = 0;
+	for (i = 0; i < NPROTO; i++) {
+		t = i - (NPROTO - 1) / 2.0;
+		h[i] = (t == 0) ? 2 * fc : sin(2 * M_PI * fc * t) / (M_PI * t);
+		h[i] *= 0.54 - 0.46 * cos(2 * M_PI * i / (NPROTO - 1));
+		sum += h[i];
+	}
+	for (i = 0; i < NPROTO; i++)
+		h[i] *= FIR_GAIN * FIR_L / sum;
+
+	/* The base is a multiple of 4, so the samples are counted from it */
+	for (k = 0; k < FIR_L; k++) {
+		off = k * FIR_M / FIR_L;
+		p = k * FIR_M % FIR_L;
+		for (iq = 0; iq < 2; iq++) {
+			n = off - (FIR_TAPS - 1);
+			if ((n & 1) != iq)
+				n++;
+			fp->first[k][iq] = n;
+			for (i = 0; i < FIR_TAPS/2; i++, n += 2) {
+				j = off - n;
+				t = h[p + j*FIR_L] * (1 << FIR_SHIFT);
+				fp->coef[k][iq][i] = lrint(t * mix[iq][n & 3]);
+			}
+		}
+		fp->last = off;
+	}
+
+	fp->len = FIR_TAPS + FIR_M + maxn;
+	if ((fp->x[0] = calloc(fp->len / 2 + 1, sizeof(short))) == NULL)
+		goto err_even;
+	if ((fp->x[1] = calloc(fp->len / 2 + 1, sizeof(short))) == NULL)
+		goto err_odd;
+	fp->fill = FIR_TAPS;
+	fp->base = FIR_TAPS;
+	fp->packed = packed;
+#ifdef FIR_X86
+	__builtin_cpu_init();
+	fp->ssse3 = __builtin_cpu_supports("ssse3");
+#endif
+	return 0;
+
+err_odd:
+	free(fp->x[0]);
+err_even:
+	return -1;
+}
+
+void fir_fini(struct fir *fp)
+{
+	free(fp->x[0]);
+	free(fp->x[1]);
+	fp->x[0] = NULL;
+	fp->x[1] = NULL;
+}
+
+/*
+ * Take n raw samples, no more than maxn of fir_init(), and put the I/Q
+ * that they complete into out. Returns the number of ints.
+ * The stream goes on from one call to the next, so the mixer keeps its
+ * phase as long as the stream starts at a multiple of 4 samples.
+ * Packed samples only come in whole groups of 8.
+ */
+int fir_run(struct fir *fp, const unsigned char *sp, int n,
+    unsigned int bias, int *out)
+{
+	short *xe = fp->x[0], *xo = fp->x[1];
+	int k, vi, vq;
+	int keep;
+	int ret;
+
+	if (fp->packed)
+		fir_load12(fp, sp, n, bias);
+	else
+		fir_load16(fp, sp, n, bias);
+
+	ret = 0;
+	while (fp->base + fp->last < fp->fill) {
+		for (k = 0; k < FIR_L; k++) {
+			fir_dot(xe + (fp->base + fp->first[k][0]) / 2,
+			    xo + (fp->base + fp->first[k][1]) / 2,
+			    fp->coef[k][0], fp->coef[k][1], &vi, &vq);
+			vi >>= FIR_SHIFT;
+			vq >>= FIR_SHIFT;
+			out[ret++] = (vi < -FIR_CLIP) ? -FIR_CLIP :
+			    (vi > FIR_CLIP) ? FIR_CLIP : vi;
+			out[ret++] = (vq < -FIR_CLIP) ? -FIR_CLIP :
+			    (vq > FIR_CLIP) ? FIR_CLIP : vq;
+		}
+		fp->base += FIR_M;
+	}
+
+	/*
+	 * Keep the windows of the outputs that are not done yet. The base
+	 * stays a multiple of 4, for the mixer.
+	 */
+	keep = fp->base - FIR_TAPS;
+	memmove(xe, xe + keep/2, ((fp->fill - keep + 1) / 2) * sizeof(short));
+	memmove(xo, xo + keep/2, ((fp->fill - keep) / 2) * sizeof(short));
+	fp->fill -= keep;
+	fp->base -= keep;
+	return ret;
+}
+
+/*
+ * Split the samples into the even and the odd ones, less the bias.
+ */
+static void fir_load16(struct fir *fp, const unsigned char *sp, int n,
+    int bias)
+{
+	short *xe = fp->x[0], *xo = fp->x[1];
+	int fill = fp->fill;
+	int i;
+
+	if (n > 0 && (fill & 1) != 0) {
+		xo[fill / 2] = (int) (sp[1]<<8 | sp[0]) - bias;
+		fill++;
+		sp += 2;
+		n--;
+	}
+	i = 0;
+#ifdef __SSE2__
+	/*
+	 * The samples are little-endian, same as x86. The even ones are
+	 * the low halves of the 32-bit lanes, and the odd ones the high.
+	 */
+	for (; i + 16 <= n; i += 16) {
+		const __m128i b16 = _mm_set1_epi16(bias);
+		__m128i v0, v1;
+
+		v0 = _mm_sub_epi16(_mm_loadu_si128((const __m128i *) sp), b16);
+		v1 = _mm_sub_epi16(
+		    _mm_loadu_si128((const __m128i *) (sp + 16)), b16);
+		_mm_storeu_si128((__m128i *) (xe + fill/2 + i/2),
+		    _mm_packs_epi32(
+		      _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16),
+		      _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16)));
+		_mm_storeu_si128((__m128i *) (xo + fill/2 + i/2),
+		    _mm_packs_epi32(_mm_srai_epi32(v0, 16),
+		      _mm_srai_epi32(v1, 16)));
+		sp += 32;
+	}
+#endif
+	for (; i + 2 <= n; i += 2) {
+		xe[fill/2 + i/2] = (int) (sp[1]<<8 | sp[0]) - bias;
+		xo[fill/2 + i/2] = (int) (sp[3]<<8 | sp[2]) - bias;
+		sp += 4;
+	}
+	if (i < n)
+		xe[fill/2 + i/2] = (int) (sp[1]<<8 | sp[0]) - bias;
+	fp->fill = fill + n;
+}
+
+static void fir_load12(struct fir *fp, const unsigned char *sp, int n,
+    int bias)
+{
+	unsigned short s[8];
+	short *xe, *xo;
+	int i, k;
+
+	xe = fp->x[0] + fp->fill / 2;
+	xo = fp->x[1] + fp->fill / 2;
+	i = 0;
+#ifdef FIR_X86
+	if (fp->ssse3) {
+		i = fir_load12_ssse3(xe, xo, sp, n, bias);
+		sp += i / 8 * 12;
+	}
+#endif
+	for (; i + 8 <= n; i += 8) {
+		fir_unpack12(s, sp, 8);
+		for (k = 0; k < 4; k++) {
+			xe[i/2 + k] = s[2*k] - bias;
+			xo[i/2 + k] = s[2*k + 1] - bias;
+		}
+		sp += 12;
+	}
+	fp->fill += i;
+}
+
+#ifdef FIR_X86
+/*
+ * Two groups of 8 at a time, so 8 even and 8 odd samples. PSHUFB puts
+ * the two bytes of every sample into its lane: the even samples are the
+ * top 12 bits of their lanes, and the odd ones the bottom 12.
+ * A load takes 16 bytes for a group of 12, so the last ones are left
+ * to the scalar code. Returns the number of samples done.
+ */
+__attribute__((target("ssse3")))
+static int fir_load12_ssse3(short *xe, short *xo, const unsigned char *sp,
+    int n, int bias)
+{
+	const __m128i even_lo = _mm_setr_epi8(2, 3, 7, 0, 4, 5, 9, 10,
+	    -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i even_hi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+	    2, 3, 7, 0, 4, 5, 9, 10);
+	const __m128i odd_lo = _mm_setr_epi8(1, 2, 6, 7, 11, 4, 8, 9,
+	    -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i odd_hi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+	    1, 2, 6, 7, 11, 4, 8, 9);
+	const __m128i mask = _mm_set1_epi16(0x0fff);
+	const __m128i b16 = _mm_set1_epi16(bias);
+	__m128i v0, v1, e, o;
+	int i;
+
+	for (i = 0; i + 24 <= n; i += 16) {
+		v0 = _mm_loadu_si128((const __m128i *) sp);
+		v1 = _mm_loadu_si128((const __m128i *) (sp + 12));
+		e = _mm_or_si128(_mm_shuffle_epi8(v0, even_lo),
+		    _mm_shuffle_epi8(v1, even_hi));
+		o = _mm_or_si128(_mm_shuffle_epi8(v0, odd_lo),
+		    _mm_shuffle_epi8(v1, odd_hi));
+		e = _mm_sub_epi16(_mm_srli_epi16(e, 4), b16);
+		o = _mm_sub_epi16(_mm_and_si128(o, mask), b16);
+		_mm_storeu_si128((__m128i *) (xe + i/2), e);
+		_mm_storeu_si128((__m128i *) (xo + i/2), o);
+		sp += 24;
+	}
+	return i;
+}
+#endif
+
+/*
+ * Unpack n samples, a multiple of 8, as libairspy does it: the packing
+ * is of 3 words of 32 bits, little-endian, with the samples from the top
+ * down. This is for the few samples that are wanted as they are.
+ */
+void fir_unpack12(unsigned short *s, const unsigned char *sp, int n)
+{
+	int i;
+
+	for (i = 0; i + 8 <= n; i += 8) {
+		s[0] = sp[3] << 4 | sp[2] >> 4;
+		s[1] = (sp[2] & 0xf) << 8 | sp[1];
+		s[2] = sp[0] << 4 | sp[7] >> 4;
+		s[3] = (sp[7] & 0xf) << 8 | sp[6];
+		s[4] = sp[5] << 4 | sp[4] >> 4;
+		s[5] = (sp[4] & 0xf) << 8 | sp[11];
+		s[6] = sp[10] << 4 | sp[9] >> 4;
+		s[7] = (sp[9] & 0xf) << 8 | sp[8];
+		s += 8;
+		sp += 12;
+	}
+}
+
+#ifdef __SSE2__
+/*
+ * PMADDWD does 8 taps at a time. I and Q go side by side, so that the
+ * one waits less for the other, and they are summed up across together.
+ */
+static void fir_dot(const short *xi, const short *xq, const short *ci,
+    const short *cq, int *ip, int *qp)
+{
+	__m128i ai, aq, s;
+	int i;
+
+	ai = _mm_setzero_si128();
+	aq = _mm_setzero_si128();
+	for (i = 0; i < FIR_TAPS/2; i += 8) {
+		ai = _mm_add_epi32(ai, _mm_madd_epi16(
+		    _mm_loadu_si128((const __m128i *) (xi + i)),
+		    _mm_load_si128((const __m128i *) (ci + i))));
+		aq = _mm_add_epi32(aq, _mm_madd_epi16(
+		    _mm_loadu_si128((const __m128i *) (xq + i)),
+		    _mm_load_si128((const __m128i *) (cq + i))));
+	}
+	s = _mm_add_epi32(_mm_unpacklo_epi32(ai, aq),
+	    _mm_unpackhi_epi32(ai, aq));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+	*ip = _mm_cvtsi128_si32(s);
+	*qp = _mm_cvtsi128_si32(_mm_shuffle_epi32(s, _MM_SHUFFLE(1, 1, 1, 1)));
+}
+#else
+static void fir_dot(const short *xi, const short *xq, const short *ci,
+    const short *cq, int *ip, int *qp)
+{
+	int i, si, sq;
+
+	si = 0;
+	sq = 0;
+	for (i = 0; i < FIR_TAPS/2; i++) {
+		si += xi[i] * ci[i];
+		sq += xq[i] * cq[i];
+	}
+	*ip = si;
+	*qp = sq;
+}
+#endif
@@ -0,0 +1,45 @@
+/*
+ * The channel filter of ruat_airspy: the mixing by fs/4, the low-pass,
+ * and the decimation, all in one pass
+ *
+ * Airspy sends real samples at 20 MHz with the carrier at fs/4, which is
+ * 10 times as many as a UAT channel of about 1.3 MHz needs. The filter
+ * is a polyphase resampler by FIR_L/FIR_M, so its output is I/Q at
+ * 20 MHz * 5/48 = 2.0833 MHz, or 2 samples per bit, the rate of ruat.
+ *
+ * Only the outputs are computed. Every one of them is a dot product of
+ * the raw samples under its window with the taps of its phase, and the
+ * mixer is folded into the taps: it only multiplies by 1, -1, or 0.
+ * Because FIR_M is a multiple of 4, the phases of the mixer repeat with
+ * those of the filter, so there are FIR_L sets of taps for I and for Q.
+ * And because the mixer zeroes the odd samples for I and the even ones
+ * for Q, those are kept apart, and every dot product is half as long.
+ *
+ * The samples come in 16 bits, or packed by Airspy, 8 in 12 bytes. The
+ * unpacking, the bias, and the split into even and odd are one pass,
+ * with PSHUFB where the CPU has it.
+ */
+#define FIR_L      5	/* interpolation */
+#define FIR_M     48	/* decimation */
+#define FIR_TAPS  96	/* per phase, a multiple of 16 */
+
+/* The most ints that fir_run() puts out for n raw samples */
+#define FIR_OUT_MAX(n)  ((((n) / FIR_M) + 1) * FIR_L * 2)
+
+struct fir {
+	short coef[FIR_L][2][FIR_TAPS/2] __attribute__((aligned(16)));
+	int first[FIR_L][2];	/* even and odd, of every window, from base */
+	int last;		/* of the last window, from base */
+	short *x[2];		/* even and odd samples less the bias */
+	int len;		/* samples in both */
+	int fill;
+	int base;		/* where the next FIR_M samples start, even */
+	int packed;
+	int ssse3;		/* the CPU has it, and we use it */
+};
+
+int fir_init(struct fir *fp, int maxn, int packed);
+void fir_fini(struct fir *fp);
+int fir_run(struct fir *fp, const unsigned char *sp, int n,
+    unsigned int bias, int *out);
+void fir_unpack12(unsigned short *s, const unsigned char *sp, int n);
@@ -0,0 +1,166 @@
+#!/usr/bin/python3
+#
+# The GF(256) tables and the generator polynomials for UAT
+#
+
+import sys
+
+TAG="gfgen"
+
+# Ann 10 vol III, 12.4.4.2.2.2.1: the primitive polynomial and the first root
+PRIM_POLY = 0x187
+FCR = 120
+
+# Must match GF_LOG_ZERO and GF_EXP_LEN in fec.h
+LOG_ZERO = 511
+EXP_LEN = 1024
+
+class ParamError(Exception):
+    pass
+
+class Param:
+    def __init__(self, argv):
+        skip = 1;  # Do skip=1 for full argv.
+        #: Output name, stdout if not given
+        self.outname = None
+        for i in range(len(argv)):
+            if skip:
+                skip = 0
+                continue
+            arg = argv[i]
+            if len(arg) != 0 and arg[0] == '-':
+                if arg == "-o":
+                    if i+1 == len(argv):
+                        raise ParamError("Parameter -o needs an argument")
+                    self.outname = argv[i+1]
+                    skip = 1;
+                else:
+                    raise ParamError("Unknown parameter " + arg)
+            else:
+                raise ParamError("Positional parameter supplied")
+
+
+# Same layout as gf_init(): field[k] = alpha^(k-1), field[0] = 0,
+# and index[] is the reverse of field[].
+def gen_field(prim_poly):
+    field = [0, 1]
+    v = 1
+    for i in range(2, 256):
+        v <<= 1
+        if v & 0x100:
+            v = (v & 0xff) ^ (prim_poly & 0xff)
+        field.append(v)
+    index = [0]*256
+    for i in range(256):
+        index[field[i]] = i
+    if sorted(field) != list(range(256)):
+        raise ValueError("Polynomial 0x%x is not primitive" % prim_poly)
+    return field, index
+
+def gen_exp_log(field):
+    exp = [0]*EXP_LEN
+    for i in range(2*255):
+        exp[i] = field[i % 255 + 1]
+    log = [0]*256
+    log[0] = LOG_ZERO
+    for i in range(255):
+        log[field[i+1]] = i
+    return exp, log
+
+# Same as p_gen_gen(): the product of (X - alpha^i) for the nroots powers,
+# with the greatest power of X first.
+def gen_gpoly(exp, log, fcr, nroots):
+    g = [1]
+    for i in range(fcr, fcr + nroots):
+        r = exp[i]
+        ng = g + [0]
+        for j in range(1, len(ng)):
+            ng[j] ^= exp[log[g[j-1]] + log[r]]
+        g = ng
+    return g
+
+def print_array(outfp, decl, vals, fmt, per_line):
+    print("%s = {" % decl, file=outfp)
+    for i in range(0, len(vals), per_line):
+        line = ", ".join([fmt % v for v in vals[i:i+per_line]])
+        print("\t%s%s" % (line, "," if i+per_line < len(vals) else ""),
+              file=outfp)
+    print("};", file=outfp)
+
+def main(args):
+    try:
+        par = Param(args)
+    except ParamError as e:
+        print(TAG+": %s" % e, file=sys.stderr)
+        print("Usage:", TAG+" [-o outfile]", file=sys.stderr)
+        return 1
+
+    field, index = gen_field(PRIM_POLY)
+    exp, log = gen_exp_log(field)
+
+    if par.outname:
+        outfp = open(par.outname, 'w')
+    else:
+        outfp = sys.stdout
+
+    print("/*", file=outfp)
+    print(" * gftab.c: generated by gfgen.py, do not edit", file=outfp)
+    print(" */", file=outfp)
+    print("#include <stddef.h>", file=outfp)
+    print("", file=outfp)
+    print("#include \"fec.h\"", file=outfp)
+    print("", file=outfp)
+    print("#define ALIGNED __attribute__((aligned(64)))", file=outfp)
+    print("", file=outfp)
+
+    print_array(outfp, "static const unsigned char gf_uat_field[256] ALIGNED",
+                field, "0x%02x", 12)
+    print("", file=outfp)
+    print_array(outfp, "static const unsigned char gf_uat_index[256] ALIGNED",
+                index, "0x%02x", 12)
+    print("", file=outfp)
+    print_array(outfp,
+                "static const unsigned char gf_uat_exp[%d] ALIGNED" % EXP_LEN,
+                exp, "0x%02x", 12)
+    print("", file=outfp)
+    print_array(outfp, "static const unsigned short gf_uat_log[256] ALIGNED",
+                log, "%3d", 12)
+    print("", file=outfp)
+
+    print("static const unsigned char gf_uat_nib[256][32] ALIGNED = {",
+          file=outfp)
+    for c in range(256):
+        nib = []
+        for x in range(16):
+            nib.append(exp[log[c] + log[x]])
+        for x in range(16):
+            nib.append(exp[log[c] + log[x << 4]])
+        print("\t{ %s,\n\t  %s }%s" % (
+              ", ".join(["0x%02x" % v for v in nib[0:16]]),
+              ", ".join(["0x%02x" % v for v in nib[16:32]]),
+              "," if c != 255 else ""), file=outfp)
+    print("};", file=outfp)
+    print("", file=outfp)
+
+    print("const struct gf gf_uat = {", file=outfp)
+    print("\t.field = gf_uat_field,", file=outfp)
+    print("\t.index = gf_uat_index,", file=outfp)
+    print("\t.nib = gf_uat_nib,", file=outfp)
+    print("\t.exp = gf_uat_exp,", file=outfp)
+    print("\t.log = gf_uat_log,", file=outfp)
+    print("\t.mem = NULL", file=outfp)
+    print("};", file=outfp)
+
+    for name, nroots in (("up", 20), ("as", 12), ("al", 14)):
+        print("", file=outfp)
+        print_array(outfp,
+                    "const unsigned char gpoly_uat_%s[%d]" % (name, nroots+1),
+                    gen_gpoly(exp, log, FCR, nroots), "0x%02x", 12)
+
+    if par.outname:
+        outfp.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
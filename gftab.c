@@ -0,0 +1,711 @@
+/*
+ * gftab.c: generated by gfgen.py, do not edit
+ */
+#include <stddef.h>
+
+#include "fec.h"
+
+#define ALIGNED __attribute__((aligned(64)))
+
+static const unsigned char gf_uat_field[256] ALIGNED = {
+	0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95,
+	0xad, 0xdd, 0x3d, 0x7a, 0xf4, 0x6f, 0xde, 0x3b, 0x76, 0xec, 0x5f, 0xbe,
+	0xfb, 0x71, 0xe2, 0x43, 0x86, 0x8b, 0x91, 0xa5, 0xcd, 0x1d, 0x3a, 0x74,
+	0xe8, 0x57, 0xae, 0xdb, 0x31, 0x62, 0xc4, 0x0f, 0x1e, 0x3c, 0x78, 0xf0,
+	0x67, 0xce, 0x1b, 0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f, 0x7e, 0xfc,
+	0x7f, 0xfe, 0x7b, 0xf6, 0x6b, 0xd6, 0x2b, 0x56, 0xac, 0xdf, 0x39, 0x72,
+	0xe4, 0x4f, 0x9e, 0xbb, 0xf1, 0x65, 0xca, 0x13, 0x26, 0x4c, 0x98, 0xb7,
+	0xe9, 0x55, 0xaa, 0xd3, 0x21, 0x42, 0x84, 0x8f, 0x99, 0xb5, 0xed, 0x5d,
+	0xba, 0xf3, 0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x07,
+	0x0e, 0x1c, 0x38, 0x70, 0xe0, 0x47, 0x8e, 0x9b, 0xb1, 0xe5, 0x4d, 0x9a,
+	0xb3, 0xe1, 0x45, 0x8a, 0x93, 0xa1, 0xc5, 0x0d, 0x1a, 0x34, 0x68, 0xd0,
+	0x27, 0x4e, 0x9c, 0xbf, 0xf9, 0x75, 0xea, 0x53, 0xa6, 0xcb, 0x11, 0x22,
+	0x44, 0x88, 0x97, 0xa9, 0xd5, 0x2d, 0x5a, 0xb4, 0xef, 0x59, 0xb2, 0xe3,
+	0x41, 0x82, 0x83, 0x81, 0x85, 0x8d, 0x9d, 0xbd, 0xfd, 0x7d, 0xfa, 0x73,
+	0xe6, 0x4b, 0x96, 0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf, 0xd9, 0x35, 0x6a,
+	0xd4, 0x2f, 0x5e, 0xbc, 0xff, 0x79, 0xf2, 0x63, 0xc6, 0x0b, 0x16, 0x2c,
+	0x58, 0xb0, 0xe7, 0x49, 0x92, 0xa3, 0xc1, 0x05, 0x0a, 0x14, 0x28, 0x50,
+	0xa0, 0xc7, 0x09, 0x12, 0x24, 0x48, 0x90, 0xa7, 0xc9, 0x15, 0x2a, 0x54,
+	0xa8, 0xd7, 0x29, 0x52, 0xa4, 0xcf, 0x19, 0x32, 0x64, 0xc8, 0x17, 0x2e,
+	0x5c, 0xb8, 0xf7, 0x69, 0xd2, 0x23, 0x46, 0x8c, 0x9f, 0xb9, 0xf5, 0x6d,
+	0xda, 0x33, 0x66, 0xcc, 0x1f, 0x3e, 0x7c, 0xf8, 0x77, 0xee, 0x5b, 0xb6,
+	0xeb, 0x51, 0xa2, 0xc3
+};
+
+static const unsigned char gf_uat_index[256] ALIGNED = {
+	0x00, 0x01, 0x02, 0x64, 0x03, 0xc7, 0x65, 0x6b, 0x04, 0xce, 0xc8, 0xbd,
+	0x66, 0x7f, 0x6c, 0x2b, 0x05, 0x8e, 0xcf, 0x4f, 0xc9, 0xd5, 0xbe, 0xe2,
+	0x67, 0xde, 0x80, 0x32, 0x6d, 0x21, 0x2c, 0xf4, 0x06, 0x58, 0x8f, 0xe9,
+	0xd0, 0xad, 0x50, 0x84, 0xca, 0xda, 0xd6, 0x42, 0xbf, 0x95, 0xe3, 0xb5,
+	0x68, 0x28, 0xdf, 0xf1, 0x81, 0xb2, 0x33, 0x36, 0x6e, 0x46, 0x22, 0x13,
+	0x2d, 0x0e, 0xf5, 0x39, 0x07, 0x9c, 0x59, 0x1b, 0x90, 0x7a, 0xea, 0x71,
+	0xd1, 0xc3, 0xae, 0xa9, 0x51, 0x76, 0x85, 0x49, 0xcb, 0xfd, 0xdb, 0x8b,
+	0xd7, 0x55, 0x43, 0x25, 0xc0, 0x99, 0x96, 0xfa, 0xe4, 0x5f, 0xb6, 0x16,
+	0x69, 0x62, 0x29, 0xbb, 0xe0, 0x4d, 0xf2, 0x30, 0x82, 0xe7, 0xb3, 0x40,
+	0x34, 0xef, 0x37, 0x11, 0x6f, 0x19, 0x47, 0xa7, 0x23, 0x89, 0x14, 0xf8,
+	0x2e, 0xb9, 0x0f, 0x3e, 0xf6, 0xa5, 0x3a, 0x3c, 0x08, 0x9f, 0x9d, 0x9e,
+	0x5a, 0xa0, 0x1c, 0x09, 0x91, 0x0a, 0x7b, 0x1d, 0xeb, 0xa1, 0x72, 0x5b,
+	0xd2, 0x1e, 0xc4, 0x7c, 0xaf, 0x0b, 0xaa, 0x92, 0x52, 0x5c, 0x77, 0x73,
+	0x86, 0xa2, 0x4a, 0xec, 0xcc, 0x7d, 0xfe, 0xc5, 0xdc, 0x1f, 0x8c, 0xd3,
+	0xd8, 0x93, 0x56, 0xab, 0x44, 0x0c, 0x26, 0xb0, 0xc1, 0x74, 0x9a, 0x78,
+	0x97, 0x5d, 0xfb, 0x53, 0xe5, 0xed, 0x60, 0x4b, 0xb7, 0xa3, 0x17, 0x87,
+	0x6a, 0xc6, 0x63, 0xff, 0x2a, 0x7e, 0xbc, 0xcd, 0xe1, 0xd4, 0x4e, 0x8d,
+	0xf3, 0x20, 0x31, 0xdd, 0x83, 0xac, 0xe8, 0x57, 0xb4, 0x94, 0x41, 0xd9,
+	0x35, 0xb1, 0xf0, 0x27, 0x38, 0x0d, 0x12, 0x45, 0x70, 0x79, 0x1a, 0x9b,
+	0x48, 0x75, 0xa8, 0xc2, 0x24, 0x54, 0x8a, 0xfc, 0x15, 0x5e, 0xf9, 0x98,
+	0x2f, 0x4c, 0xba, 0x61, 0x10, 0xee, 0x3f, 0xe6, 0xf7, 0x88, 0xa6, 0x18,
+	0x3b, 0xa4, 0x3d, 0xb8
+};
+
+static const unsigned char gf_uat_exp[1024] ALIGNED = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad,
+	0xdd, 0x3d, 0x7a, 0xf4, 0x6f, 0xde, 0x3b, 0x76, 0xec, 0x5f, 0xbe, 0xfb,
+	0x71, 0xe2, 0x43, 0x86, 0x8b, 0x91, 0xa5, 0xcd, 0x1d, 0x3a, 0x74, 0xe8,
+	0x57, 0xae, 0xdb, 0x31, 0x62, 0xc4, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0x67,
+	0xce, 0x1b, 0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f, 0x7e, 0xfc, 0x7f,
+	0xfe, 0x7b, 0xf6, 0x6b, 0xd6, 0x2b, 0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4,
+	0x4f, 0x9e, 0xbb, 0xf1, 0x65, 0xca, 0x13, 0x26, 0x4c, 0x98, 0xb7, 0xe9,
+	0x55, 0xaa, 0xd3, 0x21, 0x42, 0x84, 0x8f, 0x99, 0xb5, 0xed, 0x5d, 0xba,
+	0xf3, 0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x07, 0x0e,
+	0x1c, 0x38, 0x70, 0xe0, 0x47, 0x8e, 0x9b, 0xb1, 0xe5, 0x4d, 0x9a, 0xb3,
+	0xe1, 0x45, 0x8a, 0x93, 0xa1, 0xc5, 0x0d, 0x1a, 0x34, 0x68, 0xd0, 0x27,
+	0x4e, 0x9c, 0xbf, 0xf9, 0x75, 0xea, 0x53, 0xa6, 0xcb, 0x11, 0x22, 0x44,
+	0x88, 0x97, 0xa9, 0xd5, 0x2d, 0x5a, 0xb4, 0xef, 0x59, 0xb2, 0xe3, 0x41,
+	0x82, 0x83, 0x81, 0x85, 0x8d, 0x9d, 0xbd, 0xfd, 0x7d, 0xfa, 0x73, 0xe6,
+	0x4b, 0x96, 0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf, 0xd9, 0x35, 0x6a, 0xd4,
+	0x2f, 0x5e, 0xbc, 0xff, 0x79, 0xf2, 0x63, 0xc6, 0x0b, 0x16, 0x2c, 0x58,
+	0xb0, 0xe7, 0x49, 0x92, 0xa3, 0xc1, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0,
+	0xc7, 0x09, 0x12, 0x24, 0x48, 0x90, 0xa7, 0xc9, 0x15, 0x2a, 0x54, 0xa8,
+	0xd7, 0x29, 0x52, 0xa4, 0xcf, 0x19, 0x32, 0x64, 0xc8, 0x17, 0x2e, 0x5c,
+	0xb8, 0xf7, 0x69, 0xd2, 0x23, 0x46, 0x8c, 0x9f, 0xb9, 0xf5, 0x6d, 0xda,
+	0x33, 0x66, 0xcc, 0x1f, 0x3e, 0x7c, 0xf8, 0x77, 0xee, 0x5b, 0xb6, 0xeb,
+	0x51, 0xa2, 0xc3, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87,
+	0x89, 0x95, 0xad, 0xdd, 0x3d, 0x7a, 0xf4, 0x6f, 0xde, 0x3b, 0x76, 0xec,
+	0x5f, 0xbe, 0xfb, 0x71, 0xe2, 0x43, 0x86, 0x8b, 0x91, 0xa5, 0xcd, 0x1d,
+	0x3a, 0x74, 0xe8, 0x57, 0xae, 0xdb, 0x31, 0x62, 0xc4, 0x0f, 0x1e, 0x3c,
+	0x78, 0xf0, 0x67, 0xce, 0x1b, 0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f,
+	0x7e, 0xfc, 0x7f, 0xfe, 0x7b, 0xf6, 0x6b, 0xd6, 0x2b, 0x56, 0xac, 0xdf,
+	0x39, 0x72, 0xe4, 0x4f, 0x9e, 0xbb, 0xf1, 0x65, 0xca, 0x13, 0x26, 0x4c,
+	0x98, 0xb7, 0xe9, 0x55, 0xaa, 0xd3, 0x21, 0x42, 0x84, 0x8f, 0x99, 0xb5,
+	0xed, 0x5d, 0xba, 0xf3, 0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60,
+	0xc0, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0x47, 0x8e, 0x9b, 0xb1, 0xe5,
+	0x4d, 0x9a, 0xb3, 0xe1, 0x45, 0x8a, 0x93, 0xa1, 0xc5, 0x0d, 0x1a, 0x34,
+	0x68, 0xd0, 0x27, 0x4e, 0x9c, 0xbf, 0xf9, 0x75, 0xea, 0x53, 0xa6, 0xcb,
+	0x11, 0x22, 0x44, 0x88, 0x97, 0xa9, 0xd5, 0x2d, 0x5a, 0xb4, 0xef, 0x59,
+	0xb2, 0xe3, 0x41, 0x82, 0x83, 0x81, 0x85, 0x8d, 0x9d, 0xbd, 0xfd, 0x7d,
+	0xfa, 0x73, 0xe6, 0x4b, 0x96, 0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf, 0xd9,
+	0x35, 0x6a, 0xd4, 0x2f, 0x5e, 0xbc, 0xff, 0x79, 0xf2, 0x63, 0xc6, 0x0b,
+	0x16, 0x2c, 0x58, 0xb0, 0xe7, 0x49, 0x92, 0xa3, 0xc1, 0x05, 0x0a, 0x14,
+	0x28, 0x50, 0xa0, 0xc7, 0x09, 0x12, 0x24, 0x48, 0x90, 0xa7, 0xc9, 0x15,
+	0x2a, 0x54, 0xa8, 0xd7, 0x29, 0x52, 0xa4, 0xcf, 0x19, 0x32, 0x64, 0xc8,
+	0x17, 0x2e, 0x5c, 0xb8, 0xf7, 0x69, 0xd2, 0x23, 0x46, 0x8c, 0x9f, 0xb9,
+	0xf5, 0x6d, 0xda, 0x33, 0x66, 0xcc, 0x1f, 0x3e, 0x7c, 0xf8, 0x77, 0xee,
+	0x5b, 0xb6, 0xeb, 0x51, 0xa2, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00
+};
+
+static const unsigned short gf_uat_log[256] ALIGNED = {
+	511,   0,   1,  99,   2, 198, 100, 106,   3, 205, 199, 188,
+	101, 126, 107,  42,   4, 141, 206,  78, 200, 212, 189, 225,
+	102, 221, 127,  49, 108,  32,  43, 243,   5,  87, 142, 232,
+	207, 172,  79, 131, 201, 217, 213,  65, 190, 148, 226, 180,
+	103,  39, 222, 240, 128, 177,  50,  53, 109,  69,  33,  18,
+	 44,  13, 244,  56,   6, 155,  88,  26, 143, 121, 233, 112,
+	208, 194, 173, 168,  80, 117, 132,  72, 202, 252, 218, 138,
+	214,  84,  66,  36, 191, 152, 149, 249, 227,  94, 181,  21,
+	104,  97,  40, 186, 223,  76, 241,  47, 129, 230, 178,  63,
+	 51, 238,  54,  16, 110,  24,  70, 166,  34, 136,  19, 247,
+	 45, 184,  14,  61, 245, 164,  57,  59,   7, 158, 156, 157,
+	 89, 159,  27,   8, 144,   9, 122,  28, 234, 160, 113,  90,
+	209,  29, 195, 123, 174,  10, 169, 145,  81,  91, 118, 114,
+	133, 161,  73, 235, 203, 124, 253, 196, 219,  30, 139, 210,
+	215, 146,  85, 170,  67,  11,  37, 175, 192, 115, 153, 119,
+	150,  92, 250,  82, 228, 236,  95,  74, 182, 162,  22, 134,
+	105, 197,  98, 254,  41, 125, 187, 204, 224, 211,  77, 140,
+	242,  31,  48, 220, 130, 171, 231,  86, 179, 147,  64, 216,
+	 52, 176, 239,  38,  55,  12,  17,  68, 111, 120,  25, 154,
+	 71, 116, 167, 193,  35,  83, 137, 251,  20,  93, 248, 151,
+	 46,  75, 185,  96,  15, 237,  62, 229, 246, 135, 165,  23,
+	 58, 163,  60, 183
+};
+
+static const unsigned char gf_uat_nib[256][32] ALIGNED = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	  0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0 },
+	{ 0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e,
+	  0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0, 0x87, 0xa7, 0xc7, 0xe7, 0x07, 0x27, 0x47, 0x67 },
+	{ 0x00, 0x03, 0x06, 0x05, 0x0c, 0x0f, 0x0a, 0x09, 0x18, 0x1b, 0x1e, 0x1d, 0x14, 0x17, 0x12, 0x11,
+	  0x00, 0x30, 0x60, 0x50, 0xc0, 0xf0, 0xa0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xc7, 0xf7, 0xa7, 0x97 },
+	{ 0x00, 0x04, 0x08, 0x0c, 0x10, 0x14, 0x18, 0x1c, 0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38, 0x3c,
+	  0x00, 0x40, 0x80, 0xc0, 0x87, 0xc7, 0x07, 0x47, 0x89, 0xc9, 0x09, 0x49, 0x0e, 0x4e, 0x8e, 0xce },
+	{ 0x00, 0x05, 0x0a, 0x0f, 0x14, 0x11, 0x1e, 0x1b, 0x28, 0x2d, 0x22, 0x27, 0x3c, 0x39, 0x36, 0x33,
+	  0x00, 0x50, 0xa0, 0xf0, 0xc7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xa9, 0xf9, 0xce, 0x9e, 0x6e, 0x3e },
+	{ 0x00, 0x06, 0x0c, 0x0a, 0x18, 0x1e, 0x14, 0x12, 0x30, 0x36, 0x3c, 0x3a, 0x28, 0x2e, 0x24, 0x22,
+	  0x00, 0x60, 0xc0, 0xa0, 0x07, 0x67, 0xc7, 0xa7, 0x0e, 0x6e, 0xce, 0xae, 0x09, 0x69, 0xc9, 0xa9 },
+	{ 0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+	  0x00, 0x70, 0xe0, 0x90, 0x47, 0x37, 0xa7, 0xd7, 0x8e, 0xfe, 0x6e, 0x1e, 0xc9, 0xb9, 0x29, 0x59 },
+	{ 0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78,
+	  0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0e, 0x8e, 0x95, 0x15, 0x12, 0x92, 0x1c, 0x9c, 0x9b, 0x1b },
+	{ 0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f, 0x48, 0x41, 0x5a, 0x53, 0x6c, 0x65, 0x7e, 0x77,
+	  0x00, 0x90, 0xa7, 0x37, 0xc9, 0x59, 0x6e, 0xfe, 0x15, 0x85, 0xb2, 0x22, 0xdc, 0x4c, 0x7b, 0xeb },
+	{ 0x00, 0x0a, 0x14, 0x1e, 0x28, 0x22, 0x3c, 0x36, 0x50, 0x5a, 0x44, 0x4e, 0x78, 0x72, 0x6c, 0x66,
+	  0x00, 0xa0, 0xc7, 0x67, 0x09, 0xa9, 0xce, 0x6e, 0x12, 0xb2, 0xd5, 0x75, 0x1b, 0xbb, 0xdc, 0x7c },
+	{ 0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31, 0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69,
+	  0x00, 0xb0, 0xe7, 0x57, 0x49, 0xf9, 0xae, 0x1e, 0x92, 0x22, 0x75, 0xc5, 0xdb, 0x6b, 0x3c, 0x8c },
+	{ 0x00, 0x0c, 0x18, 0x14, 0x30, 0x3c, 0x28, 0x24, 0x60, 0x6c, 0x78, 0x74, 0x50, 0x5c, 0x48, 0x44,
+	  0x00, 0xc0, 0x07, 0xc7, 0x0e, 0xce, 0x09, 0xc9, 0x1c, 0xdc, 0x1b, 0xdb, 0x12, 0xd2, 0x15, 0xd5 },
+	{ 0x00, 0x0d, 0x1a, 0x17, 0x34, 0x39, 0x2e, 0x23, 0x68, 0x65, 0x72, 0x7f, 0x5c, 0x51, 0x46, 0x4b,
+	  0x00, 0xd0, 0x27, 0xf7, 0x4e, 0x9e, 0x69, 0xb9, 0x9c, 0x4c, 0xbb, 0x6b, 0xd2, 0x02, 0xf5, 0x25 },
+	{ 0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a, 0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a,
+	  0x00, 0xe0, 0x47, 0xa7, 0x8e, 0x6e, 0xc9, 0x29, 0x9b, 0x7b, 0xdc, 0x3c, 0x15, 0xf5, 0x52, 0xb2 },
+	{ 0x00, 0x0f, 0x1e, 0x11, 0x3c, 0x33, 0x22, 0x2d, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4b, 0x5a, 0x55,
+	  0x00, 0xf0, 0x67, 0x97, 0xce, 0x3e, 0xa9, 0x59, 0x1b, 0xeb, 0x7c, 0x8c, 0xd5, 0x25, 0xb2, 0x42 },
+	{ 0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0,
+	  0x00, 0x87, 0x89, 0x0e, 0x95, 0x12, 0x1c, 0x9b, 0xad, 0x2a, 0x24, 0xa3, 0x38, 0xbf, 0xb1, 0x36 },
+	{ 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+	  0x00, 0x97, 0xa9, 0x3e, 0xd5, 0x42, 0x7c, 0xeb, 0x2d, 0xba, 0x84, 0x13, 0xf8, 0x6f, 0x51, 0xc6 },
+	{ 0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e, 0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee,
+	  0x00, 0xa7, 0xc9, 0x6e, 0x15, 0xb2, 0xdc, 0x7b, 0x2a, 0x8d, 0xe3, 0x44, 0x3f, 0x98, 0xf6, 0x51 },
+	{ 0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79, 0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1,
+	  0x00, 0xb7, 0xe9, 0x5e, 0x55, 0xe2, 0xbc, 0x0b, 0xaa, 0x1d, 0x43, 0xf4, 0xff, 0x48, 0x16, 0xa1 },
+	{ 0x00, 0x14, 0x28, 0x3c, 0x50, 0x44, 0x78, 0x6c, 0xa0, 0xb4, 0x88, 0x9c, 0xf0, 0xe4, 0xd8, 0xcc,
+	  0x00, 0xc7, 0x09, 0xce, 0x12, 0xd5, 0x1b, 0xdc, 0x24, 0xe3, 0x2d, 0xea, 0x36, 0xf1, 0x3f, 0xf8 },
+	{ 0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b, 0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3,
+	  0x00, 0xd7, 0x29, 0xfe, 0x52, 0x85, 0x7b, 0xac, 0xa4, 0x73, 0x8d, 0x5a, 0xf6, 0x21, 0xdf, 0x08 },
+	{ 0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62, 0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2,
+	  0x00, 0xe7, 0x49, 0xae, 0x92, 0x75, 0xdb, 0x3c, 0xa3, 0x44, 0xea, 0x0d, 0x31, 0xd6, 0x78, 0x9f },
+	{ 0x00, 0x17, 0x2e, 0x39, 0x5c, 0x4b, 0x72, 0x65, 0xb8, 0xaf, 0x96, 0x81, 0xe4, 0xf3, 0xca, 0xdd,
+	  0x00, 0xf7, 0x69, 0x9e, 0xd2, 0x25, 0xbb, 0x4c, 0x23, 0xd4, 0x4a, 0xbd, 0xf1, 0x06, 0x98, 0x6f },
+	{ 0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xc0, 0xd8, 0xf0, 0xe8, 0xa0, 0xb8, 0x90, 0x88,
+	  0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d },
+	{ 0x00, 0x19, 0x32, 0x2b, 0x64, 0x7d, 0x56, 0x4f, 0xc8, 0xd1, 0xfa, 0xe3, 0xac, 0xb5, 0x9e, 0x87,
+	  0x00, 0x17, 0x2e, 0x39, 0x5c, 0x4b, 0x72, 0x65, 0xb8, 0xaf, 0x96, 0x81, 0xe4, 0xf3, 0xca, 0xdd },
+	{ 0x00, 0x1a, 0x34, 0x2e, 0x68, 0x72, 0x5c, 0x46, 0xd0, 0xca, 0xe4, 0xfe, 0xb8, 0xa2, 0x8c, 0x96,
+	  0x00, 0x27, 0x4e, 0x69, 0x9c, 0xbb, 0xd2, 0xf5, 0xbf, 0x98, 0xf1, 0xd6, 0x23, 0x04, 0x6d, 0x4a },
+	{ 0x00, 0x1b, 0x36, 0x2d, 0x6c, 0x77, 0x5a, 0x41, 0xd8, 0xc3, 0xee, 0xf5, 0xb4, 0xaf, 0x82, 0x99,
+	  0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85, 0x3f, 0x08, 0x51, 0x66, 0xe3, 0xd4, 0x8d, 0xba },
+	{ 0x00, 0x1c, 0x38, 0x24, 0x70, 0x6c, 0x48, 0x54, 0xe0, 0xfc, 0xd8, 0xc4, 0x90, 0x8c, 0xa8, 0xb4,
+	  0x00, 0x47, 0x8e, 0xc9, 0x9b, 0xdc, 0x15, 0x52, 0xb1, 0xf6, 0x3f, 0x78, 0x2a, 0x6d, 0xa4, 0xe3 },
+	{ 0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53, 0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb,
+	  0x00, 0x57, 0xae, 0xf9, 0xdb, 0x8c, 0x75, 0x22, 0x31, 0x66, 0x9f, 0xc8, 0xea, 0xbd, 0x44, 0x13 },
+	{ 0x00, 0x1e, 0x3c, 0x22, 0x78, 0x66, 0x44, 0x5a, 0xf0, 0xee, 0xcc, 0xd2, 0x88, 0x96, 0xb4, 0xaa,
+	  0x00, 0x67, 0xce, 0xa9, 0x1b, 0x7c, 0xd5, 0xb2, 0x36, 0x51, 0xf8, 0x9f, 0x2d, 0x4a, 0xe3, 0x84 },
+	{ 0x00, 0x1f, 0x3e, 0x21, 0x7c, 0x63, 0x42, 0x5d, 0xf8, 0xe7, 0xc6, 0xd9, 0x84, 0x9b, 0xba, 0xa5,
+	  0x00, 0x77, 0xee, 0x99, 0x5b, 0x2c, 0xb5, 0xc2, 0xb6, 0xc1, 0x58, 0x2f, 0xed, 0x9a, 0x03, 0x74 },
+	{ 0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0, 0x87, 0xa7, 0xc7, 0xe7, 0x07, 0x27, 0x47, 0x67,
+	  0x00, 0x89, 0x95, 0x1c, 0xad, 0x24, 0x38, 0xb1, 0xdd, 0x54, 0x48, 0xc1, 0x70, 0xf9, 0xe5, 0x6c },
+	{ 0x00, 0x21, 0x42, 0x63, 0x84, 0xa5, 0xc6, 0xe7, 0x8f, 0xae, 0xcd, 0xec, 0x0b, 0x2a, 0x49, 0x68,
+	  0x00, 0x99, 0xb5, 0x2c, 0xed, 0x74, 0x58, 0xc1, 0x5d, 0xc4, 0xe8, 0x71, 0xb0, 0x29, 0x05, 0x9c },
+	{ 0x00, 0x22, 0x44, 0x66, 0x88, 0xaa, 0xcc, 0xee, 0x97, 0xb5, 0xd3, 0xf1, 0x1f, 0x3d, 0x5b, 0x79,
+	  0x00, 0xa9, 0xd5, 0x7c, 0x2d, 0x84, 0xf8, 0x51, 0x5a, 0xf3, 0x8f, 0x26, 0x77, 0xde, 0xa2, 0x0b },
+	{ 0x00, 0x23, 0x46, 0x65, 0x8c, 0xaf, 0xca, 0xe9, 0x9f, 0xbc, 0xd9, 0xfa, 0x13, 0x30, 0x55, 0x76,
+	  0x00, 0xb9, 0xf5, 0x4c, 0x6d, 0xd4, 0x98, 0x21, 0xda, 0x63, 0x2f, 0x96, 0xb7, 0x0e, 0x42, 0xfb },
+	{ 0x00, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0xd8, 0xfc, 0xa7, 0x83, 0xef, 0xcb, 0x37, 0x13, 0x7f, 0x5b,
+	  0x00, 0xc9, 0x15, 0xdc, 0x2a, 0xe3, 0x3f, 0xf6, 0x54, 0x9d, 0x41, 0x88, 0x7e, 0xb7, 0x6b, 0xa2 },
+	{ 0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb1, 0xde, 0xfb, 0xaf, 0x8a, 0xe5, 0xc0, 0x3b, 0x1e, 0x71, 0x54,
+	  0x00, 0xd9, 0x35, 0xec, 0x6a, 0xb3, 0x5f, 0x86, 0xd4, 0x0d, 0xe1, 0x38, 0xbe, 0x67, 0x8b, 0x52 },
+	{ 0x00, 0x26, 0x4c, 0x6a, 0x98, 0xbe, 0xd4, 0xf2, 0xb7, 0x91, 0xfb, 0xdd, 0x2f, 0x09, 0x63, 0x45,
+	  0x00, 0xe9, 0x55, 0xbc, 0xaa, 0x43, 0xff, 0x16, 0xd3, 0x3a, 0x86, 0x6f, 0x79, 0x90, 0x2c, 0xc5 },
+	{ 0x00, 0x27, 0x4e, 0x69, 0x9c, 0xbb, 0xd2, 0xf5, 0xbf, 0x98, 0xf1, 0xd6, 0x23, 0x04, 0x6d, 0x4a,
+	  0x00, 0xf9, 0x75, 0x8c, 0xea, 0x13, 0x9f, 0x66, 0x53, 0xaa, 0x26, 0xdf, 0xb9, 0x40, 0xcc, 0x35 },
+	{ 0x00, 0x28, 0x50, 0x78, 0xa0, 0x88, 0xf0, 0xd8, 0xc7, 0xef, 0x97, 0xbf, 0x67, 0x4f, 0x37, 0x1f,
+	  0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f, 0x48, 0x41, 0x5a, 0x53, 0x6c, 0x65, 0x7e, 0x77 },
+	{ 0x00, 0x29, 0x52, 0x7b, 0xa4, 0x8d, 0xf6, 0xdf, 0xcf, 0xe6, 0x9d, 0xb4, 0x6b, 0x42, 0x39, 0x10,
+	  0x00, 0x19, 0x32, 0x2b, 0x64, 0x7d, 0x56, 0x4f, 0xc8, 0xd1, 0xfa, 0xe3, 0xac, 0xb5, 0x9e, 0x87 },
+	{ 0x00, 0x2a, 0x54, 0x7e, 0xa8, 0x82, 0xfc, 0xd6, 0xd7, 0xfd, 0x83, 0xa9, 0x7f, 0x55, 0x2b, 0x01,
+	  0x00, 0x29, 0x52, 0x7b, 0xa4, 0x8d, 0xf6, 0xdf, 0xcf, 0xe6, 0x9d, 0xb4, 0x6b, 0x42, 0x39, 0x10 },
+	{ 0x00, 0x2b, 0x56, 0x7d, 0xac, 0x87, 0xfa, 0xd1, 0xdf, 0xf4, 0x89, 0xa2, 0x73, 0x58, 0x25, 0x0e,
+	  0x00, 0x39, 0x72, 0x4b, 0xe4, 0xdd, 0x96, 0xaf, 0x4f, 0x76, 0x3d, 0x04, 0xab, 0x92, 0xd9, 0xe0 },
+	{ 0x00, 0x2c, 0x58, 0x74, 0xb0, 0x9c, 0xe8, 0xc4, 0xe7, 0xcb, 0xbf, 0x93, 0x57, 0x7b, 0x0f, 0x23,
+	  0x00, 0x49, 0x92, 0xdb, 0xa3, 0xea, 0x31, 0x78, 0xc1, 0x88, 0x53, 0x1a, 0x62, 0x2b, 0xf0, 0xb9 },
+	{ 0x00, 0x2d, 0x5a, 0x77, 0xb4, 0x99, 0xee, 0xc3, 0xef, 0xc2, 0xb5, 0x98, 0x5b, 0x76, 0x01, 0x2c,
+	  0x00, 0x59, 0xb2, 0xeb, 0xe3, 0xba, 0x51, 0x08, 0x41, 0x18, 0xf3, 0xaa, 0xa2, 0xfb, 0x10, 0x49 },
+	{ 0x00, 0x2e, 0x5c, 0x72, 0xb8, 0x96, 0xe4, 0xca, 0xf7, 0xd9, 0xab, 0x85, 0x4f, 0x61, 0x13, 0x3d,
+	  0x00, 0x69, 0xd2, 0xbb, 0x23, 0x4a, 0xf1, 0x98, 0x46, 0x2f, 0x94, 0xfd, 0x65, 0x0c, 0xb7, 0xde },
+	{ 0x00, 0x2f, 0x5e, 0x71, 0xbc, 0x93, 0xe2, 0xcd, 0xff, 0xd0, 0xa1, 0x8e, 0x43, 0x6c, 0x1d, 0x32,
+	  0x00, 0x79, 0xf2, 0x8b, 0x63, 0x1a, 0x91, 0xe8, 0xc6, 0xbf, 0x34, 0x4d, 0xa5, 0xdc, 0x57, 0x2e },
+	{ 0x00, 0x30, 0x60, 0x50, 0xc0, 0xf0, 0xa0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xc7, 0xf7, 0xa7, 0x97,
+	  0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a, 0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a },
+	{ 0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97, 0x0f, 0x3e, 0x6d, 0x5c, 0xcb, 0xfa, 0xa9, 0x98,
+	  0x00, 0x1e, 0x3c, 0x22, 0x78, 0x66, 0x44, 0x5a, 0xf0, 0xee, 0xcc, 0xd2, 0x88, 0x96, 0xb4, 0xaa },
+	{ 0x00, 0x32, 0x64, 0x56, 0xc8, 0xfa, 0xac, 0x9e, 0x17, 0x25, 0x73, 0x41, 0xdf, 0xed, 0xbb, 0x89,
+	  0x00, 0x2e, 0x5c, 0x72, 0xb8, 0x96, 0xe4, 0xca, 0xf7, 0xd9, 0xab, 0x85, 0x4f, 0x61, 0x13, 0x3d },
+	{ 0x00, 0x33, 0x66, 0x55, 0xcc, 0xff, 0xaa, 0x99, 0x1f, 0x2c, 0x79, 0x4a, 0xd3, 0xe0, 0xb5, 0x86,
+	  0x00, 0x3e, 0x7c, 0x42, 0xf8, 0xc6, 0x84, 0xba, 0x77, 0x49, 0x0b, 0x35, 0x8f, 0xb1, 0xf3, 0xcd },
+	{ 0x00, 0x34, 0x68, 0x5c, 0xd0, 0xe4, 0xb8, 0x8c, 0x27, 0x13, 0x4f, 0x7b, 0xf7, 0xc3, 0x9f, 0xab,
+	  0x00, 0x4e, 0x9c, 0xd2, 0xbf, 0xf1, 0x23, 0x6d, 0xf9, 0xb7, 0x65, 0x2b, 0x46, 0x08, 0xda, 0x94 },
+	{ 0x00, 0x35, 0x6a, 0x5f, 0xd4, 0xe1, 0xbe, 0x8b, 0x2f, 0x1a, 0x45, 0x70, 0xfb, 0xce, 0x91, 0xa4,
+	  0x00, 0x5e, 0xbc, 0xe2, 0xff, 0xa1, 0x43, 0x1d, 0x79, 0x27, 0xc5, 0x9b, 0x86, 0xd8, 0x3a, 0x64 },
+	{ 0x00, 0x36, 0x6c, 0x5a, 0xd8, 0xee, 0xb4, 0x82, 0x37, 0x01, 0x5b, 0x6d, 0xef, 0xd9, 0x83, 0xb5,
+	  0x00, 0x6e, 0xdc, 0xb2, 0x3f, 0x51, 0xe3, 0x8d, 0x7e, 0x10, 0xa2, 0xcc, 0x41, 0x2f, 0x9d, 0xf3 },
+	{ 0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85, 0x3f, 0x08, 0x51, 0x66, 0xe3, 0xd4, 0x8d, 0xba,
+	  0x00, 0x7e, 0xfc, 0x82, 0x7f, 0x01, 0x83, 0xfd, 0xfe, 0x80, 0x02, 0x7c, 0x81, 0xff, 0x7d, 0x03 },
+	{ 0x00, 0x38, 0x70, 0x48, 0xe0, 0xd8, 0x90, 0xa8, 0x47, 0x7f, 0x37, 0x0f, 0xa7, 0x9f, 0xd7, 0xef,
+	  0x00, 0x8e, 0x9b, 0x15, 0xb1, 0x3f, 0x2a, 0xa4, 0xe5, 0x6b, 0x7e, 0xf0, 0x54, 0xda, 0xcf, 0x41 },
+	{ 0x00, 0x39, 0x72, 0x4b, 0xe4, 0xdd, 0x96, 0xaf, 0x4f, 0x76, 0x3d, 0x04, 0xab, 0x92, 0xd9, 0xe0,
+	  0x00, 0x9e, 0xbb, 0x25, 0xf1, 0x6f, 0x4a, 0xd4, 0x65, 0xfb, 0xde, 0x40, 0x94, 0x0a, 0x2f, 0xb1 },
+	{ 0x00, 0x3a, 0x74, 0x4e, 0xe8, 0xd2, 0x9c, 0xa6, 0x57, 0x6d, 0x23, 0x19, 0xbf, 0x85, 0xcb, 0xf1,
+	  0x00, 0xae, 0xdb, 0x75, 0x31, 0x9f, 0xea, 0x44, 0x62, 0xcc, 0xb9, 0x17, 0x53, 0xfd, 0x88, 0x26 },
+	{ 0x00, 0x3b, 0x76, 0x4d, 0xec, 0xd7, 0x9a, 0xa1, 0x5f, 0x64, 0x29, 0x12, 0xb3, 0x88, 0xc5, 0xfe,
+	  0x00, 0xbe, 0xfb, 0x45, 0x71, 0xcf, 0x8a, 0x34, 0xe2, 0x5c, 0x19, 0xa7, 0x93, 0x2d, 0x68, 0xd6 },
+	{ 0x00, 0x3c, 0x78, 0x44, 0xf0, 0xcc, 0x88, 0xb4, 0x67, 0x5b, 0x1f, 0x23, 0x97, 0xab, 0xef, 0xd3,
+	  0x00, 0xce, 0x1b, 0xd5, 0x36, 0xf8, 0x2d, 0xe3, 0x6c, 0xa2, 0x77, 0xb9, 0x5a, 0x94, 0x41, 0x8f },
+	{ 0x00, 0x3d, 0x7a, 0x47, 0xf4, 0xc9, 0x8e, 0xb3, 0x6f, 0x52, 0x15, 0x28, 0x9b, 0xa6, 0xe1, 0xdc,
+	  0x00, 0xde, 0x3b, 0xe5, 0x76, 0xa8, 0x4d, 0x93, 0xec, 0x32, 0xd7, 0x09, 0x9a, 0x44, 0xa1, 0x7f },
+	{ 0x00, 0x3e, 0x7c, 0x42, 0xf8, 0xc6, 0x84, 0xba, 0x77, 0x49, 0x0b, 0x35, 0x8f, 0xb1, 0xf3, 0xcd,
+	  0x00, 0xee, 0x5b, 0xb5, 0xb6, 0x58, 0xed, 0x03, 0xeb, 0x05, 0xb0, 0x5e, 0x5d, 0xb3, 0x06, 0xe8 },
+	{ 0x00, 0x3f, 0x7e, 0x41, 0xfc, 0xc3, 0x82, 0xbd, 0x7f, 0x40, 0x01, 0x3e, 0x83, 0xbc, 0xfd, 0xc2,
+	  0x00, 0xfe, 0x7b, 0x85, 0xf6, 0x08, 0x8d, 0x73, 0x6b, 0x95, 0x10, 0xee, 0x9d, 0x63, 0xe6, 0x18 },
+	{ 0x00, 0x40, 0x80, 0xc0, 0x87, 0xc7, 0x07, 0x47, 0x89, 0xc9, 0x09, 0x49, 0x0e, 0x4e, 0x8e, 0xce,
+	  0x00, 0x95, 0xad, 0x38, 0xdd, 0x48, 0x70, 0xe5, 0x3d, 0xa8, 0x90, 0x05, 0xe0, 0x75, 0x4d, 0xd8 },
+	{ 0x00, 0x41, 0x82, 0xc3, 0x83, 0xc2, 0x01, 0x40, 0x81, 0xc0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xc1,
+	  0x00, 0x85, 0x8d, 0x08, 0x9d, 0x18, 0x10, 0x95, 0xbd, 0x38, 0x30, 0xb5, 0x20, 0xa5, 0xad, 0x28 },
+	{ 0x00, 0x42, 0x84, 0xc6, 0x8f, 0xcd, 0x0b, 0x49, 0x99, 0xdb, 0x1d, 0x5f, 0x16, 0x54, 0x92, 0xd0,
+	  0x00, 0xb5, 0xed, 0x58, 0x5d, 0xe8, 0xb0, 0x05, 0xba, 0x0f, 0x57, 0xe2, 0xe7, 0x52, 0x0a, 0xbf },
+	{ 0x00, 0x43, 0x86, 0xc5, 0x8b, 0xc8, 0x0d, 0x4e, 0x91, 0xd2, 0x17, 0x54, 0x1a, 0x59, 0x9c, 0xdf,
+	  0x00, 0xa5, 0xcd, 0x68, 0x1d, 0xb8, 0xd0, 0x75, 0x3a, 0x9f, 0xf7, 0x52, 0x27, 0x82, 0xea, 0x4f },
+	{ 0x00, 0x44, 0x88, 0xcc, 0x97, 0xd3, 0x1f, 0x5b, 0xa9, 0xed, 0x21, 0x65, 0x3e, 0x7a, 0xb6, 0xf2,
+	  0x00, 0xd5, 0x2d, 0xf8, 0x5a, 0x8f, 0x77, 0xa2, 0xb4, 0x61, 0x99, 0x4c, 0xee, 0x3b, 0xc3, 0x16 },
+	{ 0x00, 0x45, 0x8a, 0xcf, 0x93, 0xd6, 0x19, 0x5c, 0xa1, 0xe4, 0x2b, 0x6e, 0x32, 0x77, 0xb8, 0xfd,
+	  0x00, 0xc5, 0x0d, 0xc8, 0x1a, 0xdf, 0x17, 0xd2, 0x34, 0xf1, 0x39, 0xfc, 0x2e, 0xeb, 0x23, 0xe6 },
+	{ 0x00, 0x46, 0x8c, 0xca, 0x9f, 0xd9, 0x13, 0x55, 0xb9, 0xff, 0x35, 0x73, 0x26, 0x60, 0xaa, 0xec,
+	  0x00, 0xf5, 0x6d, 0x98, 0xda, 0x2f, 0xb7, 0x42, 0x33, 0xc6, 0x5e, 0xab, 0xe9, 0x1c, 0x84, 0x71 },
+	{ 0x00, 0x47, 0x8e, 0xc9, 0x9b, 0xdc, 0x15, 0x52, 0xb1, 0xf6, 0x3f, 0x78, 0x2a, 0x6d, 0xa4, 0xe3,
+	  0x00, 0xe5, 0x4d, 0xa8, 0x9a, 0x7f, 0xd7, 0x32, 0xb3, 0x56, 0xfe, 0x1b, 0x29, 0xcc, 0x64, 0x81 },
+	{ 0x00, 0x48, 0x90, 0xd8, 0xa7, 0xef, 0x37, 0x7f, 0xc9, 0x81, 0x59, 0x11, 0x6e, 0x26, 0xfe, 0xb6,
+	  0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b, 0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3 },
+	{ 0x00, 0x49, 0x92, 0xdb, 0xa3, 0xea, 0x31, 0x78, 0xc1, 0x88, 0x53, 0x1a, 0x62, 0x2b, 0xf0, 0xb9,
+	  0x00, 0x05, 0x0a, 0x0f, 0x14, 0x11, 0x1e, 0x1b, 0x28, 0x2d, 0x22, 0x27, 0x3c, 0x39, 0x36, 0x33 },
+	{ 0x00, 0x4a, 0x94, 0xde, 0xaf, 0xe5, 0x3b, 0x71, 0xd9, 0x93, 0x4d, 0x07, 0x76, 0x3c, 0xe2, 0xa8,
+	  0x00, 0x35, 0x6a, 0x5f, 0xd4, 0xe1, 0xbe, 0x8b, 0x2f, 0x1a, 0x45, 0x70, 0xfb, 0xce, 0x91, 0xa4 },
+	{ 0x00, 0x4b, 0x96, 0xdd, 0xab, 0xe0, 0x3d, 0x76, 0xd1, 0x9a, 0x47, 0x0c, 0x7a, 0x31, 0xec, 0xa7,
+	  0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb1, 0xde, 0xfb, 0xaf, 0x8a, 0xe5, 0xc0, 0x3b, 0x1e, 0x71, 0x54 },
+	{ 0x00, 0x4c, 0x98, 0xd4, 0xb7, 0xfb, 0x2f, 0x63, 0xe9, 0xa5, 0x71, 0x3d, 0x5e, 0x12, 0xc6, 0x8a,
+	  0x00, 0x55, 0xaa, 0xff, 0xd3, 0x86, 0x79, 0x2c, 0x21, 0x74, 0x8b, 0xde, 0xf2, 0xa7, 0x58, 0x0d },
+	{ 0x00, 0x4d, 0x9a, 0xd7, 0xb3, 0xfe, 0x29, 0x64, 0xe1, 0xac, 0x7b, 0x36, 0x52, 0x1f, 0xc8, 0x85,
+	  0x00, 0x45, 0x8a, 0xcf, 0x93, 0xd6, 0x19, 0x5c, 0xa1, 0xe4, 0x2b, 0x6e, 0x32, 0x77, 0xb8, 0xfd },
+	{ 0x00, 0x4e, 0x9c, 0xd2, 0xbf, 0xf1, 0x23, 0x6d, 0xf9, 0xb7, 0x65, 0x2b, 0x46, 0x08, 0xda, 0x94,
+	  0x00, 0x75, 0xea, 0x9f, 0x53, 0x26, 0xb9, 0xcc, 0xa6, 0xd3, 0x4c, 0x39, 0xf5, 0x80, 0x1f, 0x6a },
+	{ 0x00, 0x4f, 0x9e, 0xd1, 0xbb, 0xf4, 0x25, 0x6a, 0xf1, 0xbe, 0x6f, 0x20, 0x4a, 0x05, 0xd4, 0x9b,
+	  0x00, 0x65, 0xca, 0xaf, 0x13, 0x76, 0xd9, 0xbc, 0x26, 0x43, 0xec, 0x89, 0x35, 0x50, 0xff, 0x9a },
+	{ 0x00, 0x50, 0xa0, 0xf0, 0xc7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xa9, 0xf9, 0xce, 0x9e, 0x6e, 0x3e,
+	  0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e, 0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee },
+	{ 0x00, 0x51, 0xa2, 0xf3, 0xc3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xa3, 0xf2, 0xc2, 0x93, 0x60, 0x31,
+	  0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e },
+	{ 0x00, 0x52, 0xa4, 0xf6, 0xcf, 0x9d, 0x6b, 0x39, 0x19, 0x4b, 0xbd, 0xef, 0xd6, 0x84, 0x72, 0x20,
+	  0x00, 0x32, 0x64, 0x56, 0xc8, 0xfa, 0xac, 0x9e, 0x17, 0x25, 0x73, 0x41, 0xdf, 0xed, 0xbb, 0x89 },
+	{ 0x00, 0x53, 0xa6, 0xf5, 0xcb, 0x98, 0x6d, 0x3e, 0x11, 0x42, 0xb7, 0xe4, 0xda, 0x89, 0x7c, 0x2f,
+	  0x00, 0x22, 0x44, 0x66, 0x88, 0xaa, 0xcc, 0xee, 0x97, 0xb5, 0xd3, 0xf1, 0x1f, 0x3d, 0x5b, 0x79 },
+	{ 0x00, 0x54, 0xa8, 0xfc, 0xd7, 0x83, 0x7f, 0x2b, 0x29, 0x7d, 0x81, 0xd5, 0xfe, 0xaa, 0x56, 0x02,
+	  0x00, 0x52, 0xa4, 0xf6, 0xcf, 0x9d, 0x6b, 0x39, 0x19, 0x4b, 0xbd, 0xef, 0xd6, 0x84, 0x72, 0x20 },
+	{ 0x00, 0x55, 0xaa, 0xff, 0xd3, 0x86, 0x79, 0x2c, 0x21, 0x74, 0x8b, 0xde, 0xf2, 0xa7, 0x58, 0x0d,
+	  0x00, 0x42, 0x84, 0xc6, 0x8f, 0xcd, 0x0b, 0x49, 0x99, 0xdb, 0x1d, 0x5f, 0x16, 0x54, 0x92, 0xd0 },
+	{ 0x00, 0x56, 0xac, 0xfa, 0xdf, 0x89, 0x73, 0x25, 0x39, 0x6f, 0x95, 0xc3, 0xe6, 0xb0, 0x4a, 0x1c,
+	  0x00, 0x72, 0xe4, 0x96, 0x4f, 0x3d, 0xab, 0xd9, 0x9e, 0xec, 0x7a, 0x08, 0xd1, 0xa3, 0x35, 0x47 },
+	{ 0x00, 0x57, 0xae, 0xf9, 0xdb, 0x8c, 0x75, 0x22, 0x31, 0x66, 0x9f, 0xc8, 0xea, 0xbd, 0x44, 0x13,
+	  0x00, 0x62, 0xc4, 0xa6, 0x0f, 0x6d, 0xcb, 0xa9, 0x1e, 0x7c, 0xda, 0xb8, 0x11, 0x73, 0xd5, 0xb7 },
+	{ 0x00, 0x58, 0xb0, 0xe8, 0xe7, 0xbf, 0x57, 0x0f, 0x49, 0x11, 0xf9, 0xa1, 0xae, 0xf6, 0x1e, 0x46,
+	  0x00, 0x92, 0xa3, 0x31, 0xc1, 0x53, 0x62, 0xf0, 0x05, 0x97, 0xa6, 0x34, 0xc4, 0x56, 0x67, 0xf5 },
+	{ 0x00, 0x59, 0xb2, 0xeb, 0xe3, 0xba, 0x51, 0x08, 0x41, 0x18, 0xf3, 0xaa, 0xa2, 0xfb, 0x10, 0x49,
+	  0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05 },
+	{ 0x00, 0x5a, 0xb4, 0xee, 0xef, 0xb5, 0x5b, 0x01, 0x59, 0x03, 0xed, 0xb7, 0xb6, 0xec, 0x02, 0x58,
+	  0x00, 0xb2, 0xe3, 0x51, 0x41, 0xf3, 0xa2, 0x10, 0x82, 0x30, 0x61, 0xd3, 0xc3, 0x71, 0x20, 0x92 },
+	{ 0x00, 0x5b, 0xb6, 0xed, 0xeb, 0xb0, 0x5d, 0x06, 0x51, 0x0a, 0xe7, 0xbc, 0xba, 0xe1, 0x0c, 0x57,
+	  0x00, 0xa2, 0xc3, 0x61, 0x01, 0xa3, 0xc2, 0x60, 0x02, 0xa0, 0xc1, 0x63, 0x03, 0xa1, 0xc0, 0x62 },
+	{ 0x00, 0x5c, 0xb8, 0xe4, 0xf7, 0xab, 0x4f, 0x13, 0x69, 0x35, 0xd1, 0x8d, 0x9e, 0xc2, 0x26, 0x7a,
+	  0x00, 0xd2, 0x23, 0xf1, 0x46, 0x94, 0x65, 0xb7, 0x8c, 0x5e, 0xaf, 0x7d, 0xca, 0x18, 0xe9, 0x3b },
+	{ 0x00, 0x5d, 0xba, 0xe7, 0xf3, 0xae, 0x49, 0x14, 0x61, 0x3c, 0xdb, 0x86, 0x92, 0xcf, 0x28, 0x75,
+	  0x00, 0xc2, 0x03, 0xc1, 0x06, 0xc4, 0x05, 0xc7, 0x0c, 0xce, 0x0f, 0xcd, 0x0a, 0xc8, 0x09, 0xcb },
+	{ 0x00, 0x5e, 0xbc, 0xe2, 0xff, 0xa1, 0x43, 0x1d, 0x79, 0x27, 0xc5, 0x9b, 0x86, 0xd8, 0x3a, 0x64,
+	  0x00, 0xf2, 0x63, 0x91, 0xc6, 0x34, 0xa5, 0x57, 0x0b, 0xf9, 0x68, 0x9a, 0xcd, 0x3f, 0xae, 0x5c },
+	{ 0x00, 0x5f, 0xbe, 0xe1, 0xfb, 0xa4, 0x45, 0x1a, 0x71, 0x2e, 0xcf, 0x90, 0x8a, 0xd5, 0x34, 0x6b,
+	  0x00, 0xe2, 0x43, 0xa1, 0x86, 0x64, 0xc5, 0x27, 0x8b, 0x69, 0xc8, 0x2a, 0x0d, 0xef, 0x4e, 0xac },
+	{ 0x00, 0x60, 0xc0, 0xa0, 0x07, 0x67, 0xc7, 0xa7, 0x0e, 0x6e, 0xce, 0xae, 0x09, 0x69, 0xc9, 0xa9,
+	  0x00, 0x1c, 0x38, 0x24, 0x70, 0x6c, 0x48, 0x54, 0xe0, 0xfc, 0xd8, 0xc4, 0x90, 0x8c, 0xa8, 0xb4 },
+	{ 0x00, 0x61, 0xc2, 0xa3, 0x03, 0x62, 0xc1, 0xa0, 0x06, 0x67, 0xc4, 0xa5, 0x05, 0x64, 0xc7, 0xa6,
+	  0x00, 0x0c, 0x18, 0x14, 0x30, 0x3c, 0x28, 0x24, 0x60, 0x6c, 0x78, 0x74, 0x50, 0x5c, 0x48, 0x44 },
+	{ 0x00, 0x62, 0xc4, 0xa6, 0x0f, 0x6d, 0xcb, 0xa9, 0x1e, 0x7c, 0xda, 0xb8, 0x11, 0x73, 0xd5, 0xb7,
+	  0x00, 0x3c, 0x78, 0x44, 0xf0, 0xcc, 0x88, 0xb4, 0x67, 0x5b, 0x1f, 0x23, 0x97, 0xab, 0xef, 0xd3 },
+	{ 0x00, 0x63, 0xc6, 0xa5, 0x0b, 0x68, 0xcd, 0xae, 0x16, 0x75, 0xd0, 0xb3, 0x1d, 0x7e, 0xdb, 0xb8,
+	  0x00, 0x2c, 0x58, 0x74, 0xb0, 0x9c, 0xe8, 0xc4, 0xe7, 0xcb, 0xbf, 0x93, 0x57, 0x7b, 0x0f, 0x23 },
+	{ 0x00, 0x64, 0xc8, 0xac, 0x17, 0x73, 0xdf, 0xbb, 0x2e, 0x4a, 0xe6, 0x82, 0x39, 0x5d, 0xf1, 0x95,
+	  0x00, 0x5c, 0xb8, 0xe4, 0xf7, 0xab, 0x4f, 0x13, 0x69, 0x35, 0xd1, 0x8d, 0x9e, 0xc2, 0x26, 0x7a },
+	{ 0x00, 0x65, 0xca, 0xaf, 0x13, 0x76, 0xd9, 0xbc, 0x26, 0x43, 0xec, 0x89, 0x35, 0x50, 0xff, 0x9a,
+	  0x00, 0x4c, 0x98, 0xd4, 0xb7, 0xfb, 0x2f, 0x63, 0xe9, 0xa5, 0x71, 0x3d, 0x5e, 0x12, 0xc6, 0x8a },
+	{ 0x00, 0x66, 0xcc, 0xaa, 0x1f, 0x79, 0xd3, 0xb5, 0x3e, 0x58, 0xf2, 0x94, 0x21, 0x47, 0xed, 0x8b,
+	  0x00, 0x7c, 0xf8, 0x84, 0x77, 0x0b, 0x8f, 0xf3, 0xee, 0x92, 0x16, 0x6a, 0x99, 0xe5, 0x61, 0x1d },
+	{ 0x00, 0x67, 0xce, 0xa9, 0x1b, 0x7c, 0xd5, 0xb2, 0x36, 0x51, 0xf8, 0x9f, 0x2d, 0x4a, 0xe3, 0x84,
+	  0x00, 0x6c, 0xd8, 0xb4, 0x37, 0x5b, 0xef, 0x83, 0x6e, 0x02, 0xb6, 0xda, 0x59, 0x35, 0x81, 0xed },
+	{ 0x00, 0x68, 0xd0, 0xb8, 0x27, 0x4f, 0xf7, 0x9f, 0x4e, 0x26, 0x9e, 0xf6, 0x69, 0x01, 0xb9, 0xd1,
+	  0x00, 0x9c, 0xbf, 0x23, 0xf9, 0x65, 0x46, 0xda, 0x75, 0xe9, 0xca, 0x56, 0x8c, 0x10, 0x33, 0xaf },
+	{ 0x00, 0x69, 0xd2, 0xbb, 0x23, 0x4a, 0xf1, 0x98, 0x46, 0x2f, 0x94, 0xfd, 0x65, 0x0c, 0xb7, 0xde,
+	  0x00, 0x8c, 0x9f, 0x13, 0xb9, 0x35, 0x26, 0xaa, 0xf5, 0x79, 0x6a, 0xe6, 0x4c, 0xc0, 0xd3, 0x5f },
+	{ 0x00, 0x6a, 0xd4, 0xbe, 0x2f, 0x45, 0xfb, 0x91, 0x5e, 0x34, 0x8a, 0xe0, 0x71, 0x1b, 0xa5, 0xcf,
+	  0x00, 0xbc, 0xff, 0x43, 0x79, 0xc5, 0x86, 0x3a, 0xf2, 0x4e, 0x0d, 0xb1, 0x8b, 0x37, 0x74, 0xc8 },
+	{ 0x00, 0x6b, 0xd6, 0xbd, 0x2b, 0x40, 0xfd, 0x96, 0x56, 0x3d, 0x80, 0xeb, 0x7d, 0x16, 0xab, 0xc0,
+	  0x00, 0xac, 0xdf, 0x73, 0x39, 0x95, 0xe6, 0x4a, 0x72, 0xde, 0xad, 0x01, 0x4b, 0xe7, 0x94, 0x38 },
+	{ 0x00, 0x6c, 0xd8, 0xb4, 0x37, 0x5b, 0xef, 0x83, 0x6e, 0x02, 0xb6, 0xda, 0x59, 0x35, 0x81, 0xed,
+	  0x00, 0xdc, 0x3f, 0xe3, 0x7e, 0xa2, 0x41, 0x9d, 0xfc, 0x20, 0xc3, 0x1f, 0x82, 0x5e, 0xbd, 0x61 },
+	{ 0x00, 0x6d, 0xda, 0xb7, 0x33, 0x5e, 0xe9, 0x84, 0x66, 0x0b, 0xbc, 0xd1, 0x55, 0x38, 0x8f, 0xe2,
+	  0x00, 0xcc, 0x1f, 0xd3, 0x3e, 0xf2, 0x21, 0xed, 0x7c, 0xb0, 0x63, 0xaf, 0x42, 0x8e, 0x5d, 0x91 },
+	{ 0x00, 0x6e, 0xdc, 0xb2, 0x3f, 0x51, 0xe3, 0x8d, 0x7e, 0x10, 0xa2, 0xcc, 0x41, 0x2f, 0x9d, 0xf3,
+	  0x00, 0xfc, 0x7f, 0x83, 0xfe, 0x02, 0x81, 0x7d, 0x7b, 0x87, 0x04, 0xf8, 0x85, 0x79, 0xfa, 0x06 },
+	{ 0x00, 0x6f, 0xde, 0xb1, 0x3b, 0x54, 0xe5, 0x8a, 0x76, 0x19, 0xa8, 0xc7, 0x4d, 0x22, 0x93, 0xfc,
+	  0x00, 0xec, 0x5f, 0xb3, 0xbe, 0x52, 0xe1, 0x0d, 0xfb, 0x17, 0xa4, 0x48, 0x45, 0xa9, 0x1a, 0xf6 },
+	{ 0x00, 0x70, 0xe0, 0x90, 0x47, 0x37, 0xa7, 0xd7, 0x8e, 0xfe, 0x6e, 0x1e, 0xc9, 0xb9, 0x29, 0x59,
+	  0x00, 0x9b, 0xb1, 0x2a, 0xe5, 0x7e, 0x54, 0xcf, 0x4d, 0xd6, 0xfc, 0x67, 0xa8, 0x33, 0x19, 0x82 },
+	{ 0x00, 0x71, 0xe2, 0x93, 0x43, 0x32, 0xa1, 0xd0, 0x86, 0xf7, 0x64, 0x15, 0xc5, 0xb4, 0x27, 0x56,
+	  0x00, 0x8b, 0x91, 0x1a, 0xa5, 0x2e, 0x34, 0xbf, 0xcd, 0x46, 0x5c, 0xd7, 0x68, 0xe3, 0xf9, 0x72 },
+	{ 0x00, 0x72, 0xe4, 0x96, 0x4f, 0x3d, 0xab, 0xd9, 0x9e, 0xec, 0x7a, 0x08, 0xd1, 0xa3, 0x35, 0x47,
+	  0x00, 0xbb, 0xf1, 0x4a, 0x65, 0xde, 0x94, 0x2f, 0xca, 0x71, 0x3b, 0x80, 0xaf, 0x14, 0x5e, 0xe5 },
+	{ 0x00, 0x73, 0xe6, 0x95, 0x4b, 0x38, 0xad, 0xde, 0x96, 0xe5, 0x70, 0x03, 0xdd, 0xae, 0x3b, 0x48,
+	  0x00, 0xab, 0xd1, 0x7a, 0x25, 0x8e, 0xf4, 0x5f, 0x4a, 0xe1, 0x9b, 0x30, 0x6f, 0xc4, 0xbe, 0x15 },
+	{ 0x00, 0x74, 0xe8, 0x9c, 0x57, 0x23, 0xbf, 0xcb, 0xae, 0xda, 0x46, 0x32, 0xf9, 0x8d, 0x11, 0x65,
+	  0x00, 0xdb, 0x31, 0xea, 0x62, 0xb9, 0x53, 0x88, 0xc4, 0x1f, 0xf5, 0x2e, 0xa6, 0x7d, 0x97, 0x4c },
+	{ 0x00, 0x75, 0xea, 0x9f, 0x53, 0x26, 0xb9, 0xcc, 0xa6, 0xd3, 0x4c, 0x39, 0xf5, 0x80, 0x1f, 0x6a,
+	  0x00, 0xcb, 0x11, 0xda, 0x22, 0xe9, 0x33, 0xf8, 0x44, 0x8f, 0x55, 0x9e, 0x66, 0xad, 0x77, 0xbc },
+	{ 0x00, 0x76, 0xec, 0x9a, 0x5f, 0x29, 0xb3, 0xc5, 0xbe, 0xc8, 0x52, 0x24, 0xe1, 0x97, 0x0d, 0x7b,
+	  0x00, 0xfb, 0x71, 0x8a, 0xe2, 0x19, 0x93, 0x68, 0x43, 0xb8, 0x32, 0xc9, 0xa1, 0x5a, 0xd0, 0x2b },
+	{ 0x00, 0x77, 0xee, 0x99, 0x5b, 0x2c, 0xb5, 0xc2, 0xb6, 0xc1, 0x58, 0x2f, 0xed, 0x9a, 0x03, 0x74,
+	  0x00, 0xeb, 0x51, 0xba, 0xa2, 0x49, 0xf3, 0x18, 0xc3, 0x28, 0x92, 0x79, 0x61, 0x8a, 0x30, 0xdb },
+	{ 0x00, 0x78, 0xf0, 0x88, 0x67, 0x1f, 0x97, 0xef, 0xce, 0xb6, 0x3e, 0x46, 0xa9, 0xd1, 0x59, 0x21,
+	  0x00, 0x1b, 0x36, 0x2d, 0x6c, 0x77, 0x5a, 0x41, 0xd8, 0xc3, 0xee, 0xf5, 0xb4, 0xaf, 0x82, 0x99 },
+	{ 0x00, 0x79, 0xf2, 0x8b, 0x63, 0x1a, 0x91, 0xe8, 0xc6, 0xbf, 0x34, 0x4d, 0xa5, 0xdc, 0x57, 0x2e,
+	  0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31, 0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69 },
+	{ 0x00, 0x7a, 0xf4, 0x8e, 0x6f, 0x15, 0x9b, 0xe1, 0xde, 0xa4, 0x2a, 0x50, 0xb1, 0xcb, 0x45, 0x3f,
+	  0x00, 0x3b, 0x76, 0x4d, 0xec, 0xd7, 0x9a, 0xa1, 0x5f, 0x64, 0x29, 0x12, 0xb3, 0x88, 0xc5, 0xfe },
+	{ 0x00, 0x7b, 0xf6, 0x8d, 0x6b, 0x10, 0x9d, 0xe6, 0xd6, 0xad, 0x20, 0x5b, 0xbd, 0xc6, 0x4b, 0x30,
+	  0x00, 0x2b, 0x56, 0x7d, 0xac, 0x87, 0xfa, 0xd1, 0xdf, 0xf4, 0x89, 0xa2, 0x73, 0x58, 0x25, 0x0e },
+	{ 0x00, 0x7c, 0xf8, 0x84, 0x77, 0x0b, 0x8f, 0xf3, 0xee, 0x92, 0x16, 0x6a, 0x99, 0xe5, 0x61, 0x1d,
+	  0x00, 0x5b, 0xb6, 0xed, 0xeb, 0xb0, 0x5d, 0x06, 0x51, 0x0a, 0xe7, 0xbc, 0xba, 0xe1, 0x0c, 0x57 },
+	{ 0x00, 0x7d, 0xfa, 0x87, 0x73, 0x0e, 0x89, 0xf4, 0xe6, 0x9b, 0x1c, 0x61, 0x95, 0xe8, 0x6f, 0x12,
+	  0x00, 0x4b, 0x96, 0xdd, 0xab, 0xe0, 0x3d, 0x76, 0xd1, 0x9a, 0x47, 0x0c, 0x7a, 0x31, 0xec, 0xa7 },
+	{ 0x00, 0x7e, 0xfc, 0x82, 0x7f, 0x01, 0x83, 0xfd, 0xfe, 0x80, 0x02, 0x7c, 0x81, 0xff, 0x7d, 0x03,
+	  0x00, 0x7b, 0xf6, 0x8d, 0x6b, 0x10, 0x9d, 0xe6, 0xd6, 0xad, 0x20, 0x5b, 0xbd, 0xc6, 0x4b, 0x30 },
+	{ 0x00, 0x7f, 0xfe, 0x81, 0x7b, 0x04, 0x85, 0xfa, 0xf6, 0x89, 0x08, 0x77, 0x8d, 0xf2, 0x73, 0x0c,
+	  0x00, 0x6b, 0xd6, 0xbd, 0x2b, 0x40, 0xfd, 0x96, 0x56, 0x3d, 0x80, 0xeb, 0x7d, 0x16, 0xab, 0xc0 },
+	{ 0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0e, 0x8e, 0x95, 0x15, 0x12, 0x92, 0x1c, 0x9c, 0x9b, 0x1b,
+	  0x00, 0xad, 0xdd, 0x70, 0x3d, 0x90, 0xe0, 0x4d, 0x7a, 0xd7, 0xa7, 0x0a, 0x47, 0xea, 0x9a, 0x37 },
+	{ 0x00, 0x81, 0x85, 0x04, 0x8d, 0x0c, 0x08, 0x89, 0x9d, 0x1c, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14,
+	  0x00, 0xbd, 0xfd, 0x40, 0x7d, 0xc0, 0x80, 0x3d, 0xfa, 0x47, 0x07, 0xba, 0x87, 0x3a, 0x7a, 0xc7 },
+	{ 0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05,
+	  0x00, 0x8d, 0x9d, 0x10, 0xbd, 0x30, 0x20, 0xad, 0xfd, 0x70, 0x60, 0xed, 0x40, 0xcd, 0xdd, 0x50 },
+	{ 0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8d, 0x0e, 0x0c, 0x8f, 0x08, 0x8b, 0x89, 0x0a,
+	  0x00, 0x9d, 0xbd, 0x20, 0xfd, 0x60, 0x40, 0xdd, 0x7d, 0xe0, 0xc0, 0x5d, 0x80, 0x1d, 0x3d, 0xa0 },
+	{ 0x00, 0x84, 0x8f, 0x0b, 0x99, 0x1d, 0x16, 0x92, 0xb5, 0x31, 0x3a, 0xbe, 0x2c, 0xa8, 0xa3, 0x27,
+	  0x00, 0xed, 0x5d, 0xb0, 0xba, 0x57, 0xe7, 0x0a, 0xf3, 0x1e, 0xae, 0x43, 0x49, 0xa4, 0x14, 0xf9 },
+	{ 0x00, 0x85, 0x8d, 0x08, 0x9d, 0x18, 0x10, 0x95, 0xbd, 0x38, 0x30, 0xb5, 0x20, 0xa5, 0xad, 0x28,
+	  0x00, 0xfd, 0x7d, 0x80, 0xfa, 0x07, 0x87, 0x7a, 0x73, 0x8e, 0x0e, 0xf3, 0x89, 0x74, 0xf4, 0x09 },
+	{ 0x00, 0x86, 0x8b, 0x0d, 0x91, 0x17, 0x1a, 0x9c, 0xa5, 0x23, 0x2e, 0xa8, 0x34, 0xb2, 0xbf, 0x39,
+	  0x00, 0xcd, 0x1d, 0xd0, 0x3a, 0xf7, 0x27, 0xea, 0x74, 0xb9, 0x69, 0xa4, 0x4e, 0x83, 0x53, 0x9e },
+	{ 0x00, 0x87, 0x89, 0x0e, 0x95, 0x12, 0x1c, 0x9b, 0xad, 0x2a, 0x24, 0xa3, 0x38, 0xbf, 0xb1, 0x36,
+	  0x00, 0xdd, 0x3d, 0xe0, 0x7a, 0xa7, 0x47, 0x9a, 0xf4, 0x29, 0xc9, 0x14, 0x8e, 0x53, 0xb3, 0x6e },
+	{ 0x00, 0x88, 0x97, 0x1f, 0xa9, 0x21, 0x3e, 0xb6, 0xd5, 0x5d, 0x42, 0xca, 0x7c, 0xf4, 0xeb, 0x63,
+	  0x00, 0x2d, 0x5a, 0x77, 0xb4, 0x99, 0xee, 0xc3, 0xef, 0xc2, 0xb5, 0x98, 0x5b, 0x76, 0x01, 0x2c },
+	{ 0x00, 0x89, 0x95, 0x1c, 0xad, 0x24, 0x38, 0xb1, 0xdd, 0x54, 0x48, 0xc1, 0x70, 0xf9, 0xe5, 0x6c,
+	  0x00, 0x3d, 0x7a, 0x47, 0xf4, 0xc9, 0x8e, 0xb3, 0x6f, 0x52, 0x15, 0x28, 0x9b, 0xa6, 0xe1, 0xdc },
+	{ 0x00, 0x8a, 0x93, 0x19, 0xa1, 0x2b, 0x32, 0xb8, 0xc5, 0x4f, 0x56, 0xdc, 0x64, 0xee, 0xf7, 0x7d,
+	  0x00, 0x0d, 0x1a, 0x17, 0x34, 0x39, 0x2e, 0x23, 0x68, 0x65, 0x72, 0x7f, 0x5c, 0x51, 0x46, 0x4b },
+	{ 0x00, 0x8b, 0x91, 0x1a, 0xa5, 0x2e, 0x34, 0xbf, 0xcd, 0x46, 0x5c, 0xd7, 0x68, 0xe3, 0xf9, 0x72,
+	  0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53, 0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb },
+	{ 0x00, 0x8c, 0x9f, 0x13, 0xb9, 0x35, 0x26, 0xaa, 0xf5, 0x79, 0x6a, 0xe6, 0x4c, 0xc0, 0xd3, 0x5f,
+	  0x00, 0x6d, 0xda, 0xb7, 0x33, 0x5e, 0xe9, 0x84, 0x66, 0x0b, 0xbc, 0xd1, 0x55, 0x38, 0x8f, 0xe2 },
+	{ 0x00, 0x8d, 0x9d, 0x10, 0xbd, 0x30, 0x20, 0xad, 0xfd, 0x70, 0x60, 0xed, 0x40, 0xcd, 0xdd, 0x50,
+	  0x00, 0x7d, 0xfa, 0x87, 0x73, 0x0e, 0x89, 0xf4, 0xe6, 0x9b, 0x1c, 0x61, 0x95, 0xe8, 0x6f, 0x12 },
+	{ 0x00, 0x8e, 0x9b, 0x15, 0xb1, 0x3f, 0x2a, 0xa4, 0xe5, 0x6b, 0x7e, 0xf0, 0x54, 0xda, 0xcf, 0x41,
+	  0x00, 0x4d, 0x9a, 0xd7, 0xb3, 0xfe, 0x29, 0x64, 0xe1, 0xac, 0x7b, 0x36, 0x52, 0x1f, 0xc8, 0x85 },
+	{ 0x00, 0x8f, 0x99, 0x16, 0xb5, 0x3a, 0x2c, 0xa3, 0xed, 0x62, 0x74, 0xfb, 0x58, 0xd7, 0xc1, 0x4e,
+	  0x00, 0x5d, 0xba, 0xe7, 0xf3, 0xae, 0x49, 0x14, 0x61, 0x3c, 0xdb, 0x86, 0x92, 0xcf, 0x28, 0x75 },
+	{ 0x00, 0x90, 0xa7, 0x37, 0xc9, 0x59, 0x6e, 0xfe, 0x15, 0x85, 0xb2, 0x22, 0xdc, 0x4c, 0x7b, 0xeb,
+	  0x00, 0x2a, 0x54, 0x7e, 0xa8, 0x82, 0xfc, 0xd6, 0xd7, 0xfd, 0x83, 0xa9, 0x7f, 0x55, 0x2b, 0x01 },
+	{ 0x00, 0x91, 0xa5, 0x34, 0xcd, 0x5c, 0x68, 0xf9, 0x1d, 0x8c, 0xb8, 0x29, 0xd0, 0x41, 0x75, 0xe4,
+	  0x00, 0x3a, 0x74, 0x4e, 0xe8, 0xd2, 0x9c, 0xa6, 0x57, 0x6d, 0x23, 0x19, 0xbf, 0x85, 0xcb, 0xf1 },
+	{ 0x00, 0x92, 0xa3, 0x31, 0xc1, 0x53, 0x62, 0xf0, 0x05, 0x97, 0xa6, 0x34, 0xc4, 0x56, 0x67, 0xf5,
+	  0x00, 0x0a, 0x14, 0x1e, 0x28, 0x22, 0x3c, 0x36, 0x50, 0x5a, 0x44, 0x4e, 0x78, 0x72, 0x6c, 0x66 },
+	{ 0x00, 0x93, 0xa1, 0x32, 0xc5, 0x56, 0x64, 0xf7, 0x0d, 0x9e, 0xac, 0x3f, 0xc8, 0x5b, 0x69, 0xfa,
+	  0x00, 0x1a, 0x34, 0x2e, 0x68, 0x72, 0x5c, 0x46, 0xd0, 0xca, 0xe4, 0xfe, 0xb8, 0xa2, 0x8c, 0x96 },
+	{ 0x00, 0x94, 0xaf, 0x3b, 0xd9, 0x4d, 0x76, 0xe2, 0x35, 0xa1, 0x9a, 0x0e, 0xec, 0x78, 0x43, 0xd7,
+	  0x00, 0x6a, 0xd4, 0xbe, 0x2f, 0x45, 0xfb, 0x91, 0x5e, 0x34, 0x8a, 0xe0, 0x71, 0x1b, 0xa5, 0xcf },
+	{ 0x00, 0x95, 0xad, 0x38, 0xdd, 0x48, 0x70, 0xe5, 0x3d, 0xa8, 0x90, 0x05, 0xe0, 0x75, 0x4d, 0xd8,
+	  0x00, 0x7a, 0xf4, 0x8e, 0x6f, 0x15, 0x9b, 0xe1, 0xde, 0xa4, 0x2a, 0x50, 0xb1, 0xcb, 0x45, 0x3f },
+	{ 0x00, 0x96, 0xab, 0x3d, 0xd1, 0x47, 0x7a, 0xec, 0x25, 0xb3, 0x8e, 0x18, 0xf4, 0x62, 0x5f, 0xc9,
+	  0x00, 0x4a, 0x94, 0xde, 0xaf, 0xe5, 0x3b, 0x71, 0xd9, 0x93, 0x4d, 0x07, 0x76, 0x3c, 0xe2, 0xa8 },
+	{ 0x00, 0x97, 0xa9, 0x3e, 0xd5, 0x42, 0x7c, 0xeb, 0x2d, 0xba, 0x84, 0x13, 0xf8, 0x6f, 0x51, 0xc6,
+	  0x00, 0x5a, 0xb4, 0xee, 0xef, 0xb5, 0x5b, 0x01, 0x59, 0x03, 0xed, 0xb7, 0xb6, 0xec, 0x02, 0x58 },
+	{ 0x00, 0x98, 0xb7, 0x2f, 0xe9, 0x71, 0x5e, 0xc6, 0x55, 0xcd, 0xe2, 0x7a, 0xbc, 0x24, 0x0b, 0x93,
+	  0x00, 0xaa, 0xd3, 0x79, 0x21, 0x8b, 0xf2, 0x58, 0x42, 0xe8, 0x91, 0x3b, 0x63, 0xc9, 0xb0, 0x1a },
+	{ 0x00, 0x99, 0xb5, 0x2c, 0xed, 0x74, 0x58, 0xc1, 0x5d, 0xc4, 0xe8, 0x71, 0xb0, 0x29, 0x05, 0x9c,
+	  0x00, 0xba, 0xf3, 0x49, 0x61, 0xdb, 0x92, 0x28, 0xc2, 0x78, 0x31, 0x8b, 0xa3, 0x19, 0x50, 0xea },
+	{ 0x00, 0x9a, 0xb3, 0x29, 0xe1, 0x7b, 0x52, 0xc8, 0x45, 0xdf, 0xf6, 0x6c, 0xa4, 0x3e, 0x17, 0x8d,
+	  0x00, 0x8a, 0x93, 0x19, 0xa1, 0x2b, 0x32, 0xb8, 0xc5, 0x4f, 0x56, 0xdc, 0x64, 0xee, 0xf7, 0x7d },
+	{ 0x00, 0x9b, 0xb1, 0x2a, 0xe5, 0x7e, 0x54, 0xcf, 0x4d, 0xd6, 0xfc, 0x67, 0xa8, 0x33, 0x19, 0x82,
+	  0x00, 0x9a, 0xb3, 0x29, 0xe1, 0x7b, 0x52, 0xc8, 0x45, 0xdf, 0xf6, 0x6c, 0xa4, 0x3e, 0x17, 0x8d },
+	{ 0x00, 0x9c, 0xbf, 0x23, 0xf9, 0x65, 0x46, 0xda, 0x75, 0xe9, 0xca, 0x56, 0x8c, 0x10, 0x33, 0xaf,
+	  0x00, 0xea, 0x53, 0xb9, 0xa6, 0x4c, 0xf5, 0x1f, 0xcb, 0x21, 0x98, 0x72, 0x6d, 0x87, 0x3e, 0xd4 },
+	{ 0x00, 0x9d, 0xbd, 0x20, 0xfd, 0x60, 0x40, 0xdd, 0x7d, 0xe0, 0xc0, 0x5d, 0x80, 0x1d, 0x3d, 0xa0,
+	  0x00, 0xfa, 0x73, 0x89, 0xe6, 0x1c, 0x95, 0x6f, 0x4b, 0xb1, 0x38, 0xc2, 0xad, 0x57, 0xde, 0x24 },
+	{ 0x00, 0x9e, 0xbb, 0x25, 0xf1, 0x6f, 0x4a, 0xd4, 0x65, 0xfb, 0xde, 0x40, 0x94, 0x0a, 0x2f, 0xb1,
+	  0x00, 0xca, 0x13, 0xd9, 0x26, 0xec, 0x35, 0xff, 0x4c, 0x86, 0x5f, 0x95, 0x6a, 0xa0, 0x79, 0xb3 },
+	{ 0x00, 0x9f, 0xb9, 0x26, 0xf5, 0x6a, 0x4c, 0xd3, 0x6d, 0xf2, 0xd4, 0x4b, 0x98, 0x07, 0x21, 0xbe,
+	  0x00, 0xda, 0x33, 0xe9, 0x66, 0xbc, 0x55, 0x8f, 0xcc, 0x16, 0xff, 0x25, 0xaa, 0x70, 0x99, 0x43 },
+	{ 0x00, 0xa0, 0xc7, 0x67, 0x09, 0xa9, 0xce, 0x6e, 0x12, 0xb2, 0xd5, 0x75, 0x1b, 0xbb, 0xdc, 0x7c,
+	  0x00, 0x24, 0x48, 0x6c, 0x90, 0xb4, 0xd8, 0xfc, 0xa7, 0x83, 0xef, 0xcb, 0x37, 0x13, 0x7f, 0x5b },
+	{ 0x00, 0xa1, 0xc5, 0x64, 0x0d, 0xac, 0xc8, 0x69, 0x1a, 0xbb, 0xdf, 0x7e, 0x17, 0xb6, 0xd2, 0x73,
+	  0x00, 0x34, 0x68, 0x5c, 0xd0, 0xe4, 0xb8, 0x8c, 0x27, 0x13, 0x4f, 0x7b, 0xf7, 0xc3, 0x9f, 0xab },
+	{ 0x00, 0xa2, 0xc3, 0x61, 0x01, 0xa3, 0xc2, 0x60, 0x02, 0xa0, 0xc1, 0x63, 0x03, 0xa1, 0xc0, 0x62,
+	  0x00, 0x04, 0x08, 0x0c, 0x10, 0x14, 0x18, 0x1c, 0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38, 0x3c },
+	{ 0x00, 0xa3, 0xc1, 0x62, 0x05, 0xa6, 0xc4, 0x67, 0x0a, 0xa9, 0xcb, 0x68, 0x0f, 0xac, 0xce, 0x6d,
+	  0x00, 0x14, 0x28, 0x3c, 0x50, 0x44, 0x78, 0x6c, 0xa0, 0xb4, 0x88, 0x9c, 0xf0, 0xe4, 0xd8, 0xcc },
+	{ 0x00, 0xa4, 0xcf, 0x6b, 0x19, 0xbd, 0xd6, 0x72, 0x32, 0x96, 0xfd, 0x59, 0x2b, 0x8f, 0xe4, 0x40,
+	  0x00, 0x64, 0xc8, 0xac, 0x17, 0x73, 0xdf, 0xbb, 0x2e, 0x4a, 0xe6, 0x82, 0x39, 0x5d, 0xf1, 0x95 },
+	{ 0x00, 0xa5, 0xcd, 0x68, 0x1d, 0xb8, 0xd0, 0x75, 0x3a, 0x9f, 0xf7, 0x52, 0x27, 0x82, 0xea, 0x4f,
+	  0x00, 0x74, 0xe8, 0x9c, 0x57, 0x23, 0xbf, 0xcb, 0xae, 0xda, 0x46, 0x32, 0xf9, 0x8d, 0x11, 0x65 },
+	{ 0x00, 0xa6, 0xcb, 0x6d, 0x11, 0xb7, 0xda, 0x7c, 0x22, 0x84, 0xe9, 0x4f, 0x33, 0x95, 0xf8, 0x5e,
+	  0x00, 0x44, 0x88, 0xcc, 0x97, 0xd3, 0x1f, 0x5b, 0xa9, 0xed, 0x21, 0x65, 0x3e, 0x7a, 0xb6, 0xf2 },
+	{ 0x00, 0xa7, 0xc9, 0x6e, 0x15, 0xb2, 0xdc, 0x7b, 0x2a, 0x8d, 0xe3, 0x44, 0x3f, 0x98, 0xf6, 0x51,
+	  0x00, 0x54, 0xa8, 0xfc, 0xd7, 0x83, 0x7f, 0x2b, 0x29, 0x7d, 0x81, 0xd5, 0xfe, 0xaa, 0x56, 0x02 },
+	{ 0x00, 0xa8, 0xd7, 0x7f, 0x29, 0x81, 0xfe, 0x56, 0x52, 0xfa, 0x85, 0x2d, 0x7b, 0xd3, 0xac, 0x04,
+	  0x00, 0xa4, 0xcf, 0x6b, 0x19, 0xbd, 0xd6, 0x72, 0x32, 0x96, 0xfd, 0x59, 0x2b, 0x8f, 0xe4, 0x40 },
+	{ 0x00, 0xa9, 0xd5, 0x7c, 0x2d, 0x84, 0xf8, 0x51, 0x5a, 0xf3, 0x8f, 0x26, 0x77, 0xde, 0xa2, 0x0b,
+	  0x00, 0xb4, 0xef, 0x5b, 0x59, 0xed, 0xb6, 0x02, 0xb2, 0x06, 0x5d, 0xe9, 0xeb, 0x5f, 0x04, 0xb0 },
+	{ 0x00, 0xaa, 0xd3, 0x79, 0x21, 0x8b, 0xf2, 0x58, 0x42, 0xe8, 0x91, 0x3b, 0x63, 0xc9, 0xb0, 0x1a,
+	  0x00, 0x84, 0x8f, 0x0b, 0x99, 0x1d, 0x16, 0x92, 0xb5, 0x31, 0x3a, 0xbe, 0x2c, 0xa8, 0xa3, 0x27 },
+	{ 0x00, 0xab, 0xd1, 0x7a, 0x25, 0x8e, 0xf4, 0x5f, 0x4a, 0xe1, 0x9b, 0x30, 0x6f, 0xc4, 0xbe, 0x15,
+	  0x00, 0x94, 0xaf, 0x3b, 0xd9, 0x4d, 0x76, 0xe2, 0x35, 0xa1, 0x9a, 0x0e, 0xec, 0x78, 0x43, 0xd7 },
+	{ 0x00, 0xac, 0xdf, 0x73, 0x39, 0x95, 0xe6, 0x4a, 0x72, 0xde, 0xad, 0x01, 0x4b, 0xe7, 0x94, 0x38,
+	  0x00, 0xe4, 0x4f, 0xab, 0x9e, 0x7a, 0xd1, 0x35, 0xbb, 0x5f, 0xf4, 0x10, 0x25, 0xc1, 0x6a, 0x8e },
+	{ 0x00, 0xad, 0xdd, 0x70, 0x3d, 0x90, 0xe0, 0x4d, 0x7a, 0xd7, 0xa7, 0x0a, 0x47, 0xea, 0x9a, 0x37,
+	  0x00, 0xf4, 0x6f, 0x9b, 0xde, 0x2a, 0xb1, 0x45, 0x3b, 0xcf, 0x54, 0xa0, 0xe5, 0x11, 0x8a, 0x7e },
+	{ 0x00, 0xae, 0xdb, 0x75, 0x31, 0x9f, 0xea, 0x44, 0x62, 0xcc, 0xb9, 0x17, 0x53, 0xfd, 0x88, 0x26,
+	  0x00, 0xc4, 0x0f, 0xcb, 0x1e, 0xda, 0x11, 0xd5, 0x3c, 0xf8, 0x33, 0xf7, 0x22, 0xe6, 0x2d, 0xe9 },
+	{ 0x00, 0xaf, 0xd9, 0x76, 0x35, 0x9a, 0xec, 0x43, 0x6a, 0xc5, 0xb3, 0x1c, 0x5f, 0xf0, 0x86, 0x29,
+	  0x00, 0xd4, 0x2f, 0xfb, 0x5e, 0x8a, 0x71, 0xa5, 0xbc, 0x68, 0x93, 0x47, 0xe2, 0x36, 0xcd, 0x19 },
+	{ 0x00, 0xb0, 0xe7, 0x57, 0x49, 0xf9, 0xae, 0x1e, 0x92, 0x22, 0x75, 0xc5, 0xdb, 0x6b, 0x3c, 0x8c,
+	  0x00, 0xa3, 0xc1, 0x62, 0x05, 0xa6, 0xc4, 0x67, 0x0a, 0xa9, 0xcb, 0x68, 0x0f, 0xac, 0xce, 0x6d },
+	{ 0x00, 0xb1, 0xe5, 0x54, 0x4d, 0xfc, 0xa8, 0x19, 0x9a, 0x2b, 0x7f, 0xce, 0xd7, 0x66, 0x32, 0x83,
+	  0x00, 0xb3, 0xe1, 0x52, 0x45, 0xf6, 0xa4, 0x17, 0x8a, 0x39, 0x6b, 0xd8, 0xcf, 0x7c, 0x2e, 0x9d },
+	{ 0x00, 0xb2, 0xe3, 0x51, 0x41, 0xf3, 0xa2, 0x10, 0x82, 0x30, 0x61, 0xd3, 0xc3, 0x71, 0x20, 0x92,
+	  0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8d, 0x0e, 0x0c, 0x8f, 0x08, 0x8b, 0x89, 0x0a },
+	{ 0x00, 0xb3, 0xe1, 0x52, 0x45, 0xf6, 0xa4, 0x17, 0x8a, 0x39, 0x6b, 0xd8, 0xcf, 0x7c, 0x2e, 0x9d,
+	  0x00, 0x93, 0xa1, 0x32, 0xc5, 0x56, 0x64, 0xf7, 0x0d, 0x9e, 0xac, 0x3f, 0xc8, 0x5b, 0x69, 0xfa },
+	{ 0x00, 0xb4, 0xef, 0x5b, 0x59, 0xed, 0xb6, 0x02, 0xb2, 0x06, 0x5d, 0xe9, 0xeb, 0x5f, 0x04, 0xb0,
+	  0x00, 0xe3, 0x41, 0xa2, 0x82, 0x61, 0xc3, 0x20, 0x83, 0x60, 0xc2, 0x21, 0x01, 0xe2, 0x40, 0xa3 },
+	{ 0x00, 0xb5, 0xed, 0x58, 0x5d, 0xe8, 0xb0, 0x05, 0xba, 0x0f, 0x57, 0xe2, 0xe7, 0x52, 0x0a, 0xbf,
+	  0x00, 0xf3, 0x61, 0x92, 0xc2, 0x31, 0xa3, 0x50, 0x03, 0xf0, 0x62, 0x91, 0xc1, 0x32, 0xa0, 0x53 },
+	{ 0x00, 0xb6, 0xeb, 0x5d, 0x51, 0xe7, 0xba, 0x0c, 0xa2, 0x14, 0x49, 0xff, 0xf3, 0x45, 0x18, 0xae,
+	  0x00, 0xc3, 0x01, 0xc2, 0x02, 0xc1, 0x03, 0xc0, 0x04, 0xc7, 0x05, 0xc6, 0x06, 0xc5, 0x07, 0xc4 },
+	{ 0x00, 0xb7, 0xe9, 0x5e, 0x55, 0xe2, 0xbc, 0x0b, 0xaa, 0x1d, 0x43, 0xf4, 0xff, 0x48, 0x16, 0xa1,
+	  0x00, 0xd3, 0x21, 0xf2, 0x42, 0x91, 0x63, 0xb0, 0x84, 0x57, 0xa5, 0x76, 0xc6, 0x15, 0xe7, 0x34 },
+	{ 0x00, 0xb8, 0xf7, 0x4f, 0x69, 0xd1, 0x9e, 0x26, 0xd2, 0x6a, 0x25, 0x9d, 0xbb, 0x03, 0x4c, 0xf4,
+	  0x00, 0x23, 0x46, 0x65, 0x8c, 0xaf, 0xca, 0xe9, 0x9f, 0xbc, 0xd9, 0xfa, 0x13, 0x30, 0x55, 0x76 },
+	{ 0x00, 0xb9, 0xf5, 0x4c, 0x6d, 0xd4, 0x98, 0x21, 0xda, 0x63, 0x2f, 0x96, 0xb7, 0x0e, 0x42, 0xfb,
+	  0x00, 0x33, 0x66, 0x55, 0xcc, 0xff, 0xaa, 0x99, 0x1f, 0x2c, 0x79, 0x4a, 0xd3, 0xe0, 0xb5, 0x86 },
+	{ 0x00, 0xba, 0xf3, 0x49, 0x61, 0xdb, 0x92, 0x28, 0xc2, 0x78, 0x31, 0x8b, 0xa3, 0x19, 0x50, 0xea,
+	  0x00, 0x03, 0x06, 0x05, 0x0c, 0x0f, 0x0a, 0x09, 0x18, 0x1b, 0x1e, 0x1d, 0x14, 0x17, 0x12, 0x11 },
+	{ 0x00, 0xbb, 0xf1, 0x4a, 0x65, 0xde, 0x94, 0x2f, 0xca, 0x71, 0x3b, 0x80, 0xaf, 0x14, 0x5e, 0xe5,
+	  0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79, 0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1 },
+	{ 0x00, 0xbc, 0xff, 0x43, 0x79, 0xc5, 0x86, 0x3a, 0xf2, 0x4e, 0x0d, 0xb1, 0x8b, 0x37, 0x74, 0xc8,
+	  0x00, 0x63, 0xc6, 0xa5, 0x0b, 0x68, 0xcd, 0xae, 0x16, 0x75, 0xd0, 0xb3, 0x1d, 0x7e, 0xdb, 0xb8 },
+	{ 0x00, 0xbd, 0xfd, 0x40, 0x7d, 0xc0, 0x80, 0x3d, 0xfa, 0x47, 0x07, 0xba, 0x87, 0x3a, 0x7a, 0xc7,
+	  0x00, 0x73, 0xe6, 0x95, 0x4b, 0x38, 0xad, 0xde, 0x96, 0xe5, 0x70, 0x03, 0xdd, 0xae, 0x3b, 0x48 },
+	{ 0x00, 0xbe, 0xfb, 0x45, 0x71, 0xcf, 0x8a, 0x34, 0xe2, 0x5c, 0x19, 0xa7, 0x93, 0x2d, 0x68, 0xd6,
+	  0x00, 0x43, 0x86, 0xc5, 0x8b, 0xc8, 0x0d, 0x4e, 0x91, 0xd2, 0x17, 0x54, 0x1a, 0x59, 0x9c, 0xdf },
+	{ 0x00, 0xbf, 0xf9, 0x46, 0x75, 0xca, 0x8c, 0x33, 0xea, 0x55, 0x13, 0xac, 0x9f, 0x20, 0x66, 0xd9,
+	  0x00, 0x53, 0xa6, 0xf5, 0xcb, 0x98, 0x6d, 0x3e, 0x11, 0x42, 0xb7, 0xe4, 0xda, 0x89, 0x7c, 0x2f },
+	{ 0x00, 0xc0, 0x07, 0xc7, 0x0e, 0xce, 0x09, 0xc9, 0x1c, 0xdc, 0x1b, 0xdb, 0x12, 0xd2, 0x15, 0xd5,
+	  0x00, 0x38, 0x70, 0x48, 0xe0, 0xd8, 0x90, 0xa8, 0x47, 0x7f, 0x37, 0x0f, 0xa7, 0x9f, 0xd7, 0xef },
+	{ 0x00, 0xc1, 0x05, 0xc4, 0x0a, 0xcb, 0x0f, 0xce, 0x14, 0xd5, 0x11, 0xd0, 0x1e, 0xdf, 0x1b, 0xda,
+	  0x00, 0x28, 0x50, 0x78, 0xa0, 0x88, 0xf0, 0xd8, 0xc7, 0xef, 0x97, 0xbf, 0x67, 0x4f, 0x37, 0x1f },
+	{ 0x00, 0xc2, 0x03, 0xc1, 0x06, 0xc4, 0x05, 0xc7, 0x0c, 0xce, 0x0f, 0xcd, 0x0a, 0xc8, 0x09, 0xcb,
+	  0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xc0, 0xd8, 0xf0, 0xe8, 0xa0, 0xb8, 0x90, 0x88 },
+	{ 0x00, 0xc3, 0x01, 0xc2, 0x02, 0xc1, 0x03, 0xc0, 0x04, 0xc7, 0x05, 0xc6, 0x06, 0xc5, 0x07, 0xc4,
+	  0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78 },
+	{ 0x00, 0xc4, 0x0f, 0xcb, 0x1e, 0xda, 0x11, 0xd5, 0x3c, 0xf8, 0x33, 0xf7, 0x22, 0xe6, 0x2d, 0xe9,
+	  0x00, 0x78, 0xf0, 0x88, 0x67, 0x1f, 0x97, 0xef, 0xce, 0xb6, 0x3e, 0x46, 0xa9, 0xd1, 0x59, 0x21 },
+	{ 0x00, 0xc5, 0x0d, 0xc8, 0x1a, 0xdf, 0x17, 0xd2, 0x34, 0xf1, 0x39, 0xfc, 0x2e, 0xeb, 0x23, 0xe6,
+	  0x00, 0x68, 0xd0, 0xb8, 0x27, 0x4f, 0xf7, 0x9f, 0x4e, 0x26, 0x9e, 0xf6, 0x69, 0x01, 0xb9, 0xd1 },
+	{ 0x00, 0xc6, 0x0b, 0xcd, 0x16, 0xd0, 0x1d, 0xdb, 0x2c, 0xea, 0x27, 0xe1, 0x3a, 0xfc, 0x31, 0xf7,
+	  0x00, 0x58, 0xb0, 0xe8, 0xe7, 0xbf, 0x57, 0x0f, 0x49, 0x11, 0xf9, 0xa1, 0xae, 0xf6, 0x1e, 0x46 },
+	{ 0x00, 0xc7, 0x09, 0xce, 0x12, 0xd5, 0x1b, 0xdc, 0x24, 0xe3, 0x2d, 0xea, 0x36, 0xf1, 0x3f, 0xf8,
+	  0x00, 0x48, 0x90, 0xd8, 0xa7, 0xef, 0x37, 0x7f, 0xc9, 0x81, 0x59, 0x11, 0x6e, 0x26, 0xfe, 0xb6 },
+	{ 0x00, 0xc8, 0x17, 0xdf, 0x2e, 0xe6, 0x39, 0xf1, 0x5c, 0x94, 0x4b, 0x83, 0x72, 0xba, 0x65, 0xad,
+	  0x00, 0xb8, 0xf7, 0x4f, 0x69, 0xd1, 0x9e, 0x26, 0xd2, 0x6a, 0x25, 0x9d, 0xbb, 0x03, 0x4c, 0xf4 },
+	{ 0x00, 0xc9, 0x15, 0xdc, 0x2a, 0xe3, 0x3f, 0xf6, 0x54, 0x9d, 0x41, 0x88, 0x7e, 0xb7, 0x6b, 0xa2,
+	  0x00, 0xa8, 0xd7, 0x7f, 0x29, 0x81, 0xfe, 0x56, 0x52, 0xfa, 0x85, 0x2d, 0x7b, 0xd3, 0xac, 0x04 },
+	{ 0x00, 0xca, 0x13, 0xd9, 0x26, 0xec, 0x35, 0xff, 0x4c, 0x86, 0x5f, 0x95, 0x6a, 0xa0, 0x79, 0xb3,
+	  0x00, 0x98, 0xb7, 0x2f, 0xe9, 0x71, 0x5e, 0xc6, 0x55, 0xcd, 0xe2, 0x7a, 0xbc, 0x24, 0x0b, 0x93 },
+	{ 0x00, 0xcb, 0x11, 0xda, 0x22, 0xe9, 0x33, 0xf8, 0x44, 0x8f, 0x55, 0x9e, 0x66, 0xad, 0x77, 0xbc,
+	  0x00, 0x88, 0x97, 0x1f, 0xa9, 0x21, 0x3e, 0xb6, 0xd5, 0x5d, 0x42, 0xca, 0x7c, 0xf4, 0xeb, 0x63 },
+	{ 0x00, 0xcc, 0x1f, 0xd3, 0x3e, 0xf2, 0x21, 0xed, 0x7c, 0xb0, 0x63, 0xaf, 0x42, 0x8e, 0x5d, 0x91,
+	  0x00, 0xf8, 0x77, 0x8f, 0xee, 0x16, 0x99, 0x61, 0x5b, 0xa3, 0x2c, 0xd4, 0xb5, 0x4d, 0xc2, 0x3a },
+	{ 0x00, 0xcd, 0x1d, 0xd0, 0x3a, 0xf7, 0x27, 0xea, 0x74, 0xb9, 0x69, 0xa4, 0x4e, 0x83, 0x53, 0x9e,
+	  0x00, 0xe8, 0x57, 0xbf, 0xae, 0x46, 0xf9, 0x11, 0xdb, 0x33, 0x8c, 0x64, 0x75, 0x9d, 0x22, 0xca },
+	{ 0x00, 0xce, 0x1b, 0xd5, 0x36, 0xf8, 0x2d, 0xe3, 0x6c, 0xa2, 0x77, 0xb9, 0x5a, 0x94, 0x41, 0x8f,
+	  0x00, 0xd8, 0x37, 0xef, 0x6e, 0xb6, 0x59, 0x81, 0xdc, 0x04, 0xeb, 0x33, 0xb2, 0x6a, 0x85, 0x5d },
+	{ 0x00, 0xcf, 0x19, 0xd6, 0x32, 0xfd, 0x2b, 0xe4, 0x64, 0xab, 0x7d, 0xb2, 0x56, 0x99, 0x4f, 0x80,
+	  0x00, 0xc8, 0x17, 0xdf, 0x2e, 0xe6, 0x39, 0xf1, 0x5c, 0x94, 0x4b, 0x83, 0x72, 0xba, 0x65, 0xad },
+	{ 0x00, 0xd0, 0x27, 0xf7, 0x4e, 0x9e, 0x69, 0xb9, 0x9c, 0x4c, 0xbb, 0x6b, 0xd2, 0x02, 0xf5, 0x25,
+	  0x00, 0xbf, 0xf9, 0x46, 0x75, 0xca, 0x8c, 0x33, 0xea, 0x55, 0x13, 0xac, 0x9f, 0x20, 0x66, 0xd9 },
+	{ 0x00, 0xd1, 0x25, 0xf4, 0x4a, 0x9b, 0x6f, 0xbe, 0x94, 0x45, 0xb1, 0x60, 0xde, 0x0f, 0xfb, 0x2a,
+	  0x00, 0xaf, 0xd9, 0x76, 0x35, 0x9a, 0xec, 0x43, 0x6a, 0xc5, 0xb3, 0x1c, 0x5f, 0xf0, 0x86, 0x29 },
+	{ 0x00, 0xd2, 0x23, 0xf1, 0x46, 0x94, 0x65, 0xb7, 0x8c, 0x5e, 0xaf, 0x7d, 0xca, 0x18, 0xe9, 0x3b,
+	  0x00, 0x9f, 0xb9, 0x26, 0xf5, 0x6a, 0x4c, 0xd3, 0x6d, 0xf2, 0xd4, 0x4b, 0x98, 0x07, 0x21, 0xbe },
+	{ 0x00, 0xd3, 0x21, 0xf2, 0x42, 0x91, 0x63, 0xb0, 0x84, 0x57, 0xa5, 0x76, 0xc6, 0x15, 0xe7, 0x34,
+	  0x00, 0x8f, 0x99, 0x16, 0xb5, 0x3a, 0x2c, 0xa3, 0xed, 0x62, 0x74, 0xfb, 0x58, 0xd7, 0xc1, 0x4e },
+	{ 0x00, 0xd4, 0x2f, 0xfb, 0x5e, 0x8a, 0x71, 0xa5, 0xbc, 0x68, 0x93, 0x47, 0xe2, 0x36, 0xcd, 0x19,
+	  0x00, 0xff, 0x79, 0x86, 0xf2, 0x0d, 0x8b, 0x74, 0x63, 0x9c, 0x1a, 0xe5, 0x91, 0x6e, 0xe8, 0x17 },
+	{ 0x00, 0xd5, 0x2d, 0xf8, 0x5a, 0x8f, 0x77, 0xa2, 0xb4, 0x61, 0x99, 0x4c, 0xee, 0x3b, 0xc3, 0x16,
+	  0x00, 0xef, 0x59, 0xb6, 0xb2, 0x5d, 0xeb, 0x04, 0xe3, 0x0c, 0xba, 0x55, 0x51, 0xbe, 0x08, 0xe7 },
+	{ 0x00, 0xd6, 0x2b, 0xfd, 0x56, 0x80, 0x7d, 0xab, 0xac, 0x7a, 0x87, 0x51, 0xfa, 0x2c, 0xd1, 0x07,
+	  0x00, 0xdf, 0x39, 0xe6, 0x72, 0xad, 0x4b, 0x94, 0xe4, 0x3b, 0xdd, 0x02, 0x96, 0x49, 0xaf, 0x70 },
+	{ 0x00, 0xd7, 0x29, 0xfe, 0x52, 0x85, 0x7b, 0xac, 0xa4, 0x73, 0x8d, 0x5a, 0xf6, 0x21, 0xdf, 0x08,
+	  0x00, 0xcf, 0x19, 0xd6, 0x32, 0xfd, 0x2b, 0xe4, 0x64, 0xab, 0x7d, 0xb2, 0x56, 0x99, 0x4f, 0x80 },
+	{ 0x00, 0xd8, 0x37, 0xef, 0x6e, 0xb6, 0x59, 0x81, 0xdc, 0x04, 0xeb, 0x33, 0xb2, 0x6a, 0x85, 0x5d,
+	  0x00, 0x3f, 0x7e, 0x41, 0xfc, 0xc3, 0x82, 0xbd, 0x7f, 0x40, 0x01, 0x3e, 0x83, 0xbc, 0xfd, 0xc2 },
+	{ 0x00, 0xd9, 0x35, 0xec, 0x6a, 0xb3, 0x5f, 0x86, 0xd4, 0x0d, 0xe1, 0x38, 0xbe, 0x67, 0x8b, 0x52,
+	  0x00, 0x2f, 0x5e, 0x71, 0xbc, 0x93, 0xe2, 0xcd, 0xff, 0xd0, 0xa1, 0x8e, 0x43, 0x6c, 0x1d, 0x32 },
+	{ 0x00, 0xda, 0x33, 0xe9, 0x66, 0xbc, 0x55, 0x8f, 0xcc, 0x16, 0xff, 0x25, 0xaa, 0x70, 0x99, 0x43,
+	  0x00, 0x1f, 0x3e, 0x21, 0x7c, 0x63, 0x42, 0x5d, 0xf8, 0xe7, 0xc6, 0xd9, 0x84, 0x9b, 0xba, 0xa5 },
+	{ 0x00, 0xdb, 0x31, 0xea, 0x62, 0xb9, 0x53, 0x88, 0xc4, 0x1f, 0xf5, 0x2e, 0xa6, 0x7d, 0x97, 0x4c,
+	  0x00, 0x0f, 0x1e, 0x11, 0x3c, 0x33, 0x22, 0x2d, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4b, 0x5a, 0x55 },
+	{ 0x00, 0xdc, 0x3f, 0xe3, 0x7e, 0xa2, 0x41, 0x9d, 0xfc, 0x20, 0xc3, 0x1f, 0x82, 0x5e, 0xbd, 0x61,
+	  0x00, 0x7f, 0xfe, 0x81, 0x7b, 0x04, 0x85, 0xfa, 0xf6, 0x89, 0x08, 0x77, 0x8d, 0xf2, 0x73, 0x0c },
+	{ 0x00, 0xdd, 0x3d, 0xe0, 0x7a, 0xa7, 0x47, 0x9a, 0xf4, 0x29, 0xc9, 0x14, 0x8e, 0x53, 0xb3, 0x6e,
+	  0x00, 0x6f, 0xde, 0xb1, 0x3b, 0x54, 0xe5, 0x8a, 0x76, 0x19, 0xa8, 0xc7, 0x4d, 0x22, 0x93, 0xfc },
+	{ 0x00, 0xde, 0x3b, 0xe5, 0x76, 0xa8, 0x4d, 0x93, 0xec, 0x32, 0xd7, 0x09, 0x9a, 0x44, 0xa1, 0x7f,
+	  0x00, 0x5f, 0xbe, 0xe1, 0xfb, 0xa4, 0x45, 0x1a, 0x71, 0x2e, 0xcf, 0x90, 0x8a, 0xd5, 0x34, 0x6b },
+	{ 0x00, 0xdf, 0x39, 0xe6, 0x72, 0xad, 0x4b, 0x94, 0xe4, 0x3b, 0xdd, 0x02, 0x96, 0x49, 0xaf, 0x70,
+	  0x00, 0x4f, 0x9e, 0xd1, 0xbb, 0xf4, 0x25, 0x6a, 0xf1, 0xbe, 0x6f, 0x20, 0x4a, 0x05, 0xd4, 0x9b },
+	{ 0x00, 0xe0, 0x47, 0xa7, 0x8e, 0x6e, 0xc9, 0x29, 0x9b, 0x7b, 0xdc, 0x3c, 0x15, 0xf5, 0x52, 0xb2,
+	  0x00, 0xb1, 0xe5, 0x54, 0x4d, 0xfc, 0xa8, 0x19, 0x9a, 0x2b, 0x7f, 0xce, 0xd7, 0x66, 0x32, 0x83 },
+	{ 0x00, 0xe1, 0x45, 0xa4, 0x8a, 0x6b, 0xcf, 0x2e, 0x93, 0x72, 0xd6, 0x37, 0x19, 0xf8, 0x5c, 0xbd,
+	  0x00, 0xa1, 0xc5, 0x64, 0x0d, 0xac, 0xc8, 0x69, 0x1a, 0xbb, 0xdf, 0x7e, 0x17, 0xb6, 0xd2, 0x73 },
+	{ 0x00, 0xe2, 0x43, 0xa1, 0x86, 0x64, 0xc5, 0x27, 0x8b, 0x69, 0xc8, 0x2a, 0x0d, 0xef, 0x4e, 0xac,
+	  0x00, 0x91, 0xa5, 0x34, 0xcd, 0x5c, 0x68, 0xf9, 0x1d, 0x8c, 0xb8, 0x29, 0xd0, 0x41, 0x75, 0xe4 },
+	{ 0x00, 0xe3, 0x41, 0xa2, 0x82, 0x61, 0xc3, 0x20, 0x83, 0x60, 0xc2, 0x21, 0x01, 0xe2, 0x40, 0xa3,
+	  0x00, 0x81, 0x85, 0x04, 0x8d, 0x0c, 0x08, 0x89, 0x9d, 0x1c, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14 },
+	{ 0x00, 0xe4, 0x4f, 0xab, 0x9e, 0x7a, 0xd1, 0x35, 0xbb, 0x5f, 0xf4, 0x10, 0x25, 0xc1, 0x6a, 0x8e,
+	  0x00, 0xf1, 0x65, 0x94, 0xca, 0x3b, 0xaf, 0x5e, 0x13, 0xe2, 0x76, 0x87, 0xd9, 0x28, 0xbc, 0x4d },
+	{ 0x00, 0xe5, 0x4d, 0xa8, 0x9a, 0x7f, 0xd7, 0x32, 0xb3, 0x56, 0xfe, 0x1b, 0x29, 0xcc, 0x64, 0x81,
+	  0x00, 0xe1, 0x45, 0xa4, 0x8a, 0x6b, 0xcf, 0x2e, 0x93, 0x72, 0xd6, 0x37, 0x19, 0xf8, 0x5c, 0xbd },
+	{ 0x00, 0xe6, 0x4b, 0xad, 0x96, 0x70, 0xdd, 0x3b, 0xab, 0x4d, 0xe0, 0x06, 0x3d, 0xdb, 0x76, 0x90,
+	  0x00, 0xd1, 0x25, 0xf4, 0x4a, 0x9b, 0x6f, 0xbe, 0x94, 0x45, 0xb1, 0x60, 0xde, 0x0f, 0xfb, 0x2a },
+	{ 0x00, 0xe7, 0x49, 0xae, 0x92, 0x75, 0xdb, 0x3c, 0xa3, 0x44, 0xea, 0x0d, 0x31, 0xd6, 0x78, 0x9f,
+	  0x00, 0xc1, 0x05, 0xc4, 0x0a, 0xcb, 0x0f, 0xce, 0x14, 0xd5, 0x11, 0xd0, 0x1e, 0xdf, 0x1b, 0xda },
+	{ 0x00, 0xe8, 0x57, 0xbf, 0xae, 0x46, 0xf9, 0x11, 0xdb, 0x33, 0x8c, 0x64, 0x75, 0x9d, 0x22, 0xca,
+	  0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97, 0x0f, 0x3e, 0x6d, 0x5c, 0xcb, 0xfa, 0xa9, 0x98 },
+	{ 0x00, 0xe9, 0x55, 0xbc, 0xaa, 0x43, 0xff, 0x16, 0xd3, 0x3a, 0x86, 0x6f, 0x79, 0x90, 0x2c, 0xc5,
+	  0x00, 0x21, 0x42, 0x63, 0x84, 0xa5, 0xc6, 0xe7, 0x8f, 0xae, 0xcd, 0xec, 0x0b, 0x2a, 0x49, 0x68 },
+	{ 0x00, 0xea, 0x53, 0xb9, 0xa6, 0x4c, 0xf5, 0x1f, 0xcb, 0x21, 0x98, 0x72, 0x6d, 0x87, 0x3e, 0xd4,
+	  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff },
+	{ 0x00, 0xeb, 0x51, 0xba, 0xa2, 0x49, 0xf3, 0x18, 0xc3, 0x28, 0x92, 0x79, 0x61, 0x8a, 0x30, 0xdb,
+	  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+	{ 0x00, 0xec, 0x5f, 0xb3, 0xbe, 0x52, 0xe1, 0x0d, 0xfb, 0x17, 0xa4, 0x48, 0x45, 0xa9, 0x1a, 0xf6,
+	  0x00, 0x71, 0xe2, 0x93, 0x43, 0x32, 0xa1, 0xd0, 0x86, 0xf7, 0x64, 0x15, 0xc5, 0xb4, 0x27, 0x56 },
+	{ 0x00, 0xed, 0x5d, 0xb0, 0xba, 0x57, 0xe7, 0x0a, 0xf3, 0x1e, 0xae, 0x43, 0x49, 0xa4, 0x14, 0xf9,
+	  0x00, 0x61, 0xc2, 0xa3, 0x03, 0x62, 0xc1, 0xa0, 0x06, 0x67, 0xc4, 0xa5, 0x05, 0x64, 0xc7, 0xa6 },
+	{ 0x00, 0xee, 0x5b, 0xb5, 0xb6, 0x58, 0xed, 0x03, 0xeb, 0x05, 0xb0, 0x5e, 0x5d, 0xb3, 0x06, 0xe8,
+	  0x00, 0x51, 0xa2, 0xf3, 0xc3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xa3, 0xf2, 0xc2, 0x93, 0x60, 0x31 },
+	{ 0x00, 0xef, 0x59, 0xb6, 0xb2, 0x5d, 0xeb, 0x04, 0xe3, 0x0c, 0xba, 0x55, 0x51, 0xbe, 0x08, 0xe7,
+	  0x00, 0x41, 0x82, 0xc3, 0x83, 0xc2, 0x01, 0x40, 0x81, 0xc0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xc1 },
+	{ 0x00, 0xf0, 0x67, 0x97, 0xce, 0x3e, 0xa9, 0x59, 0x1b, 0xeb, 0x7c, 0x8c, 0xd5, 0x25, 0xb2, 0x42,
+	  0x00, 0x36, 0x6c, 0x5a, 0xd8, 0xee, 0xb4, 0x82, 0x37, 0x01, 0x5b, 0x6d, 0xef, 0xd9, 0x83, 0xb5 },
+	{ 0x00, 0xf1, 0x65, 0x94, 0xca, 0x3b, 0xaf, 0x5e, 0x13, 0xe2, 0x76, 0x87, 0xd9, 0x28, 0xbc, 0x4d,
+	  0x00, 0x26, 0x4c, 0x6a, 0x98, 0xbe, 0xd4, 0xf2, 0xb7, 0x91, 0xfb, 0xdd, 0x2f, 0x09, 0x63, 0x45 },
+	{ 0x00, 0xf2, 0x63, 0x91, 0xc6, 0x34, 0xa5, 0x57, 0x0b, 0xf9, 0x68, 0x9a, 0xcd, 0x3f, 0xae, 0x5c,
+	  0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62, 0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2 },
+	{ 0x00, 0xf3, 0x61, 0x92, 0xc2, 0x31, 0xa3, 0x50, 0x03, 0xf0, 0x62, 0x91, 0xc1, 0x32, 0xa0, 0x53,
+	  0x00, 0x06, 0x0c, 0x0a, 0x18, 0x1e, 0x14, 0x12, 0x30, 0x36, 0x3c, 0x3a, 0x28, 0x2e, 0x24, 0x22 },
+	{ 0x00, 0xf4, 0x6f, 0x9b, 0xde, 0x2a, 0xb1, 0x45, 0x3b, 0xcf, 0x54, 0xa0, 0xe5, 0x11, 0x8a, 0x7e,
+	  0x00, 0x76, 0xec, 0x9a, 0x5f, 0x29, 0xb3, 0xc5, 0xbe, 0xc8, 0x52, 0x24, 0xe1, 0x97, 0x0d, 0x7b },
+	{ 0x00, 0xf5, 0x6d, 0x98, 0xda, 0x2f, 0xb7, 0x42, 0x33, 0xc6, 0x5e, 0xab, 0xe9, 0x1c, 0x84, 0x71,
+	  0x00, 0x66, 0xcc, 0xaa, 0x1f, 0x79, 0xd3, 0xb5, 0x3e, 0x58, 0xf2, 0x94, 0x21, 0x47, 0xed, 0x8b },
+	{ 0x00, 0xf6, 0x6b, 0x9d, 0xd6, 0x20, 0xbd, 0x4b, 0x2b, 0xdd, 0x40, 0xb6, 0xfd, 0x0b, 0x96, 0x60,
+	  0x00, 0x56, 0xac, 0xfa, 0xdf, 0x89, 0x73, 0x25, 0x39, 0x6f, 0x95, 0xc3, 0xe6, 0xb0, 0x4a, 0x1c },
+	{ 0x00, 0xf7, 0x69, 0x9e, 0xd2, 0x25, 0xbb, 0x4c, 0x23, 0xd4, 0x4a, 0xbd, 0xf1, 0x06, 0x98, 0x6f,
+	  0x00, 0x46, 0x8c, 0xca, 0x9f, 0xd9, 0x13, 0x55, 0xb9, 0xff, 0x35, 0x73, 0x26, 0x60, 0xaa, 0xec },
+	{ 0x00, 0xf8, 0x77, 0x8f, 0xee, 0x16, 0x99, 0x61, 0x5b, 0xa3, 0x2c, 0xd4, 0xb5, 0x4d, 0xc2, 0x3a,
+	  0x00, 0xb6, 0xeb, 0x5d, 0x51, 0xe7, 0xba, 0x0c, 0xa2, 0x14, 0x49, 0xff, 0xf3, 0x45, 0x18, 0xae },
+	{ 0x00, 0xf9, 0x75, 0x8c, 0xea, 0x13, 0x9f, 0x66, 0x53, 0xaa, 0x26, 0xdf, 0xb9, 0x40, 0xcc, 0x35,
+	  0x00, 0xa6, 0xcb, 0x6d, 0x11, 0xb7, 0xda, 0x7c, 0x22, 0x84, 0xe9, 0x4f, 0x33, 0x95, 0xf8, 0x5e },
+	{ 0x00, 0xfa, 0x73, 0x89, 0xe6, 0x1c, 0x95, 0x6f, 0x4b, 0xb1, 0x38, 0xc2, 0xad, 0x57, 0xde, 0x24,
+	  0x00, 0x96, 0xab, 0x3d, 0xd1, 0x47, 0x7a, 0xec, 0x25, 0xb3, 0x8e, 0x18, 0xf4, 0x62, 0x5f, 0xc9 },
+	{ 0x00, 0xfb, 0x71, 0x8a, 0xe2, 0x19, 0x93, 0x68, 0x43, 0xb8, 0x32, 0xc9, 0xa1, 0x5a, 0xd0, 0x2b,
+	  0x00, 0x86, 0x8b, 0x0d, 0x91, 0x17, 0x1a, 0x9c, 0xa5, 0x23, 0x2e, 0xa8, 0x34, 0xb2, 0xbf, 0x39 },
+	{ 0x00, 0xfc, 0x7f, 0x83, 0xfe, 0x02, 0x81, 0x7d, 0x7b, 0x87, 0x04, 0xf8, 0x85, 0x79, 0xfa, 0x06,
+	  0x00, 0xf6, 0x6b, 0x9d, 0xd6, 0x20, 0xbd, 0x4b, 0x2b, 0xdd, 0x40, 0xb6, 0xfd, 0x0b, 0x96, 0x60 },
+	{ 0x00, 0xfd, 0x7d, 0x80, 0xfa, 0x07, 0x87, 0x7a, 0x73, 0x8e, 0x0e, 0xf3, 0x89, 0x74, 0xf4, 0x09,
+	  0x00, 0xe6, 0x4b, 0xad, 0x96, 0x70, 0xdd, 0x3b, 0xab, 0x4d, 0xe0, 0x06, 0x3d, 0xdb, 0x76, 0x90 },
+	{ 0x00, 0xfe, 0x7b, 0x85, 0xf6, 0x08, 0x8d, 0x73, 0x6b, 0x95, 0x10, 0xee, 0x9d, 0x63, 0xe6, 0x18,
+	  0x00, 0xd6, 0x2b, 0xfd, 0x56, 0x80, 0x7d, 0xab, 0xac, 0x7a, 0x87, 0x51, 0xfa, 0x2c, 0xd1, 0x07 },
+	{ 0x00, 0xff, 0x79, 0x86, 0xf2, 0x0d, 0x8b, 0x74, 0x63, 0x9c, 0x1a, 0xe5, 0x91, 0x6e, 0xe8, 0x17,
+	  0x00, 0xc6, 0x0b, 0xcd, 0x16, 0xd0, 0x1d, 0xdb, 0x2c, 0xea, 0x27, 0xe1, 0x3a, 0xfc, 0x31, 0xf7 }
+};
+
+const struct gf gf_uat = {
+	.field = gf_uat_field,
+	.index = gf_uat_index,
+	.nib = gf_uat_nib,
+	.exp = gf_uat_exp,
+	.log = gf_uat_log,
+	.mem = NULL
+};
+
+const unsigned char gpoly_uat_up[21] = {
+	0x01, 0x9b, 0x91, 0x8c, 0x91, 0xe1, 0x4f, 0x0c, 0x7c, 0x91, 0x6c, 0x3a,
+	0xa2, 0x8e, 0x42, 0xcb, 0x37, 0x80, 0x7b, 0xb4, 0x62
+};
+
+const unsigned char gpoly_uat_as[13] = {
+	0x01, 0x65, 0x56, 0x83, 0x8b, 0xb5, 0xcf, 0x42, 0xec, 0x97, 0x36, 0x3f,
+	0xd2
+};
+
+const unsigned char gpoly_uat_al[15] = {
+	0x01, 0xb7, 0x1b, 0x5f, 0x72, 0x43, 0xcb, 0xf9, 0x53, 0xbe, 0xd6, 0x3d,
+	0x31, 0x72, 0x66
+};
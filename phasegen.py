@@ -58,7 +58,7 @@ def main(args):
     com_fac = 255.0 / com_fun(2047)
     print("// com_fac == %f" % (com_fac,), file=outfp)
 
-    print("int com_tab[2048] = {", file=outfp)
+    print("const unsigned char com_tab[2048] = {", file=outfp)
     print("    0,", file=outfp)
     old_cy = 0
     crev = [0]*256;
@@ -73,9 +73,10 @@ def main(args):
     print("};", file=outfp)
 
     #
-    # Compute the arc-tangent table
+    # Compute the arc-tangent table, in binary angles of 2*pi == 65536.
+    # Being in the first quadrant, they go from 0 to 16384.
     #
-    print("float phi_tab[256][256] = {", file=outfp)
+    print("const unsigned short phi_tab[256][256] = {", file=outfp)
     for i in range(256):
         i_raw = crev[i]
         print("  {", file=outfp)
@@ -85,7 +86,8 @@ def main(args):
                 phi = 0.0
             else:
                 phi = math.atan2(float(i_raw), float(j_raw))
-            print("    %f%s" % (phi, ("" if j == 255 else ",")), file=outfp)
+            ba = int(round(phi * 65536 / (2*math.pi)))
+            print("    %d%s" % (ba, ("" if j == 255 else ",")), file=outfp)
         print("  }" if i == 255 else "  },", file=outfp)
     print("};", file=outfp)
 
@@ -0,0 +1,178 @@
+/*
+ * The ring: a lock-free single-producer, single-consumer queue
+ *
+ * The head and the tail only ever grow, and wrap around in unsigned int,
+ * so that head - tail is the number of full slots, and the slot of either
+ * is that modulo nslots.
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "ring.h"
+
+static void ring_kick(struct ring *r);
+
+int ring_init(struct ring *r, unsigned int nslots, size_t size)
+{
+	if (nslots == 0 || (nslots & (nslots - 1)) != 0)
+		return -1;
+
+	memset(r, 0, sizeof(struct ring));
+	r->nslots = nslots;
+	/* Keep the slots apart, so neither side shares a line with the other */
+	r->size = (size + RING_CACHELINE-1) & ~(size_t)(RING_CACHELINE-1);
+
+	if (posix_memalign((void **) &r->mem, RING_CACHELINE,
+	    nslots * r->size) != 0)
+		goto err_mem;
+	r->lens = calloc(nslots, sizeof(size_t));
+	if (r->lens == NULL)
+		goto err_lens;
+	r->efd = eventfd(0, EFD_CLOEXEC);
+	if (r->efd == -1)
+		goto err_efd;
+	return 0;
+
+err_efd:
+	free(r->lens);
+err_lens:
+	free(r->mem);
+err_mem:
+	return -1;
+}
+
+void ring_fini(struct ring *r)
+{
+	close(r->efd);
+	free(r->lens);
+	free(r->mem);
+}
+
+/*
+ * Producer: get the next free slot, or NULL if the ring is full.
+ */
+void *ring_claim(struct ring *r)
+{
+	unsigned int head = r->head;
+
+	if (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) >= r->nslots) {
+		__atomic_store_n(&r->drops, r->drops + 1, __ATOMIC_RELAXED);
+		return NULL;
+	}
+	return r->mem + (size_t)(head & (r->nslots - 1)) * r->size;
+}
+
+/*
+ * Producer: publish the slot that ring_claim() returned.
+ */
+void ring_commit(struct ring *r, size_t len)
+{
+	unsigned int head = r->head;
+
+	r->lens[head & (r->nslots - 1)] = len;
+	__atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+
+	/*
+	 * Pairs with the fence in ring_wait(): either we see the consumer
+	 * asleep, or it sees our head before it goes to sleep.
+	 */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&r->sleeping, __ATOMIC_RELAXED))
+		ring_kick(r);
+}
+
+/*
+ * Consumer: get the oldest full slot, or NULL if the ring is empty.
+ */
+void *ring_peek(struct ring *r, size_t *lenp)
+{
+	unsigned int tail = r->tail;
+	unsigned int x;
+
+	if (__atomic_load_n(&r->head, __ATOMIC_ACQUIRE) == tail)
+		return NULL;
+	x = tail & (r->nslots - 1);
+	*lenp = r->lens[x];
+	return r->mem + (size_t)x * r->size;
+}
+
+/*
+ * Consumer: return the slot that ring_peek() returned.
+ */
+void ring_release(struct ring *r)
+{
+	__atomic_store_n(&r->tail, r->tail + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Consumer: sleep until the ring is not empty. Returns 1 if there's
+ * something to peek at, 0 on timeout, -1 if the ring is closed and empty.
+ */
+int ring_wait(struct ring *r, int timeout_ms)
+{
+	struct pollfd pfd;
+	uint64_t cnt;
+	int rc;
+
+	for (;;) {
+		if (__atomic_load_n(&r->head, __ATOMIC_ACQUIRE) != r->tail)
+			return 1;
+		if (__atomic_load_n(&r->closed, __ATOMIC_ACQUIRE))
+			return -1;
+
+		__atomic_store_n(&r->sleeping, 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&r->head, __ATOMIC_ACQUIRE) != r->tail ||
+		    __atomic_load_n(&r->closed, __ATOMIC_ACQUIRE)) {
+			__atomic_store_n(&r->sleeping, 0, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		pfd.fd = r->efd;
+		pfd.events = POLLIN;
+		rc = poll(&pfd, 1, timeout_ms);
+		__atomic_store_n(&r->sleeping, 0, __ATOMIC_RELAXED);
+		if (rc < 0 && errno != EINTR)
+			return -1;
+		if (rc > 0) {
+			if (read(r->efd, &cnt, sizeof(cnt)) < 0 &&
+			    errno != EAGAIN)
+				return -1;
+		}
+		if (rc == 0)
+			return __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) !=
+			    r->tail;
+	}
+}
+
+/*
+ * Either side: tell the consumer that nothing more is coming.
+ */
+void ring_close(struct ring *r)
+{
+	__atomic_store_n(&r->closed, 1, __ATOMIC_RELEASE);
+	ring_kick(r);
+}
+
+/*
+ * The number of buffers that the producer found no room for, ever.
+ */
+unsigned long ring_drops(const struct ring *r)
+{
+	return __atomic_load_n(&r->drops, __ATOMIC_RELAXED);
+}
+
+static void ring_kick(struct ring *r)
+{
+	uint64_t one = 1;
+
+	/* Only fails if the counter is about to overflow, which is fine */
+	if (write(r->efd, &one, sizeof(one)) < 0)
+		;
+}
@@ -0,0 +1,44 @@
+/*
+ * The ring: buffers passed from the USB callback to the decoder
+ *
+ * This is a single-producer, single-consumer queue of fixed size slots,
+ * preallocated at init. Neither side ever takes a lock. The producer
+ * claims a slot, fills it, and commits it; when the ring is full, the
+ * claim fails and the drop is counted. The consumer peeks at the oldest
+ * slot, uses it in place, and releases it.
+ *
+ * The consumer sleeps on an eventfd only when the ring is empty, and the
+ * producer only writes to it when the consumer says it's asleep. So,
+ * a busy decoder is never woken up, and there's no syscall per buffer.
+ */
+#include <stddef.h>
+
+#define RING_CACHELINE  64
+
+struct ring {
+	/* Written by the producer */
+	unsigned int head __attribute__((aligned(RING_CACHELINE)));
+	unsigned long drops;
+
+	/* Written by the consumer */
+	unsigned int tail __attribute__((aligned(RING_CACHELINE)));
+	int sleeping;
+
+	/* Constant after ring_init(), but for the closed flag */
+	int efd __attribute__((aligned(RING_CACHELINE)));
+	int closed;
+	unsigned int nslots;	/* a power of 2 */
+	size_t size;		/* bytes in every slot */
+	unsigned char *mem;
+	size_t *lens;
+};
+
+int ring_init(struct ring *r, unsigned int nslots, size_t size);
+void ring_fini(struct ring *r);
+void *ring_claim(struct ring *r);
+void ring_commit(struct ring *r, size_t len);
+void *ring_peek(struct ring *r, size_t *lenp);
+void ring_release(struct ring *r);
+int ring_wait(struct ring *r, int timeout_ms);
+void ring_close(struct ring *r);
+unsigned long ring_drops(const struct ring *r);
@@ -9,19 +9,19 @@
 #include <sys/time.h>
 #include <math.h>
 #include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-
-#include <rtl-sdr.h>
-#define BUF_MAX  256
-/*
- * The built-in default is not visible to rtlsdr clients. So, hardcode.
- */
-#define DEFAULT_BUF_LENGTH	(16 * 32 * 512)
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "fec.h"
+#include "serve.h"
+#include "source.h"
+#include "writer.h"
 
 #define TAG "ruat"
 
@@ -29,14 +29,15 @@
 #define UAT_MOD      312500	/* notional modulation */
 #define UAT_RATE (2*1041667)
 
-#define NBITS 36		/* sync length for both Active and Uplink */
-
 /*
- * The code should work as long as BITS_LEN > NBITS and BITS_LEN > BITS_UPLINK.
- * Considering how big the phi buffers are, could as well use a megabyte. But
- * let's not blow caches so easily. So, maybe experiment with the size one day.
+ * Phase angles are binary: 2*pi is 65536, so that they are unsigned short
+ * and differences wrap around by themselves when cast to short.
+ * BA_FREQ is the angle that a frequency advances in one sample.
  */
-#define BITS_LEN      10000
+#define BA_RAD(r)     ((unsigned short) lrint((r) * (32768 / M_PI)))
+#define BA_FREQ(hz)   ((int) ((hz) * 65536.0 / UAT_RATE + 0.5))
+
+#define NBITS 36		/* sync length for both Active and Uplink */
 
 #define BITS_ACTIVE_S   240	/* 144 bits data + 96 bits FEC */
 #define BITS_ACTIVE_L   384	/* 272 bits data + 112 bits FEC */
@@ -44,10 +45,10 @@
 #define BITS_U_STEP     736	/* or as they say, 92 8-bit codewords */
 
 /*
- * The primitive polynomial of UAT is defined by ICAO Annex 10 Volume III,
- * 12.4.4.1.3.1 and 12.4.4.2.2.2.1 as p(x) = x^8 + x^7 + x^2 + x + 1, or 0x187.
+ * The sync is found as the bits come, so the bit buffer only ever holds
+ * the payload of one packet, and the longest one is the Uplink.
  */
-#define GF256_POLY_UAT 0x187
+#define BITS_LEN      BITS_UPLINK
 
 struct ss_stat {
 	unsigned long mark;
@@ -55,243 +56,348 @@ struct ss_stat {
 	unsigned long goodbits;
 	unsigned long goodlen;
 	unsigned int goodsynca, goodsyncu;	/* ADS-B and Uplink */
+	unsigned int fuzzsync;			/* syncs with bit errors */
+	unsigned int fixed;			/* symbols corrected by FEC */
+	unsigned long drops;			/* buffers the source dropped */
+	unsigned long lost;			/* lines the writer dropped */
+	unsigned long slow;			/* clients cut off */
 };
 
 struct param {
+	const char *source;	/* see source.h */
 	int gain;
 	int raw;
 	int dump_interval;	/* seconds */
+	int maxeras;		/* -1 for t of every code */
+	int syncerrs;		/* bit errors tolerated in a sync word */
+	int mode;		/* MODE_RUN or MODE_CORR, see scan_iq() */
+	int fec_threads;	/* 0 to decode in the scan thread */
+	int latency;		/* ms that a line may wait in the writer */
+	int nlisten;
+	struct {
+		const char *addr;
+		int kind;	/* SERVE_BIN or SERVE_TEXT */
+	} listen[SERVE_MAXL];
 };
 
+#define MODE_RUN   0	/* sync within runs of bits in the limits */
+#define MODE_CORR  1	/* sync by correlation, bits by the sign only */
+
 /*
- * Pack a string of 8 bit-per-byte bits into a byte.
+ * The bits are packed into 64-bit words, first bit in the MSB, so that
+ * any 64 bits starting at any offset are two shifts away, see bits_get64().
+ * There's always one more word, so that bits_get64() can read past the end.
  *
  * Stricly speaking, Anx.10 V.3 12.4.4.2.2.2.2 only talks about the bit
  * order of bytes of FEC, but it's unthinkable to have it different from
  * the data bytes, right? So, MSB first it is.
  */
-#define PICK_BYTE(p)	\
-	( (((p)[0] & 1) << 7) | \
-	  (((p)[1] & 1) << 6) | \
-	  (((p)[2] & 1) << 5) | \
-	  (((p)[3] & 1) << 4) | \
-	  (((p)[4] & 1) << 3) | \
-	  (((p)[5] & 1) << 2) | \
-	  (((p)[6] & 1) << 1) | \
-	   ((p)[7] & 1) )
+#define BITS_WORDS  ((BITS_LEN + 63) / 64 + 1)
+
+/*
+ * The sync words, 36 bits each. One is the complement of the other, so
+ * the distance to SYNC_U is NBITS less the distance to SYNC_A.
+ */
+#define SYNC_A  0xEACDDA4E2ULL
+#define SYNC_U  0x153225B1DULL
+#define SYNC_MASK  ((1ULL << NBITS) - 1)
+#define SYNC_ERRS_MAX  8	/* any more, and the noise syncs all the time */
+
+/* The parity of the Uplink less 2, the most that any code takes */
+#define ERAS_MAX  18
+
+/*
+ * The correlation detector only bothers with candidates within CORR_GATE
+ * bit errors, and takes those with the normalized correlation of at least
+ * CORR_THRESH percent, see scan_soft().
+ */
+#define CORR_GATE    8
+#define CORR_THRESH  75
 
 struct scan {
 	int runlen;		/* Run length for statistic */
 
-	char *bits;
+	uint64_t sreg;		/* the last bits, in the LSB, for the sync */
+	int sfill;		/* good bits in sreg since the last frame, to NBITS */
+	short dring[64];	/* delta_phi of the last bits, for MODE_CORR */
+	unsigned int dpos;	/* bits into dring[] ever, it wraps */
+
+	uint64_t *bits;
+	unsigned char *conf;	/* reliability of every bit in bits[] */
 	int bfill;		/* Total bits in bits[] */
-	int bwanted;		/* Target amount to complete packet */
+	int bwanted;		/* Target amount to complete packet, 0 if none */
+	unsigned long pos;	/* sample just after the last bit in bits[] */
+};
+
+/*
+ * We have 2 samples per bit, so there are two ways to pair them up, and
+ * a burst may be aligned with either of them. So, we run two scans, one
+ * for each phase, and feed them the delta_phi of every other sample.
+ */
+struct slicer {
+	struct scan phase[2];
+	unsigned short phi;	/* last sample of the previous buffer */
+	unsigned long pos;	/* samples so far */
+};
+
+#define DEDUP_N       8		/* frames remembered */
+#define DEDUP_WINDOW  4		/* samples apart, for the same frame */
+
+/*
+ * The frames that were printed, and the failures, with len 0. The last
+ * failure is held back until the other phase had its chance at the same
+ * burst, see frame_flush().
+ */
+struct dedup {
+	struct {
+		unsigned long pos;
+		int len;
+		unsigned char data[BITS_UPLINK/8];
+	} frame[DEDUP_N];
+	int next;
+	struct {
+		unsigned long pos;
+		int nbits;		/* 0 if none is held */
+		int bad;
+	} fail;
+};
+
+/*
+ * The last sync, so that a burst is counted once, see sync_count().
+ */
+struct sync_mark {
+	unsigned long pos;
+	int bwanted;
+};
+
+/*
+ * A frame on its way from the slicer to the output
+ *
+ * The slicer packs the bits and the reliabilities, a FEC thread decodes
+ * the data in place (or into out[] for the Uplink, which is interleaved),
+ * and the output prints it. The frames go through a table of NFRAMES by
+ * sequence number, so they come out in the order they came in, no matter
+ * which FEC thread finishes first. See pipe_submit().
+ */
+struct frame {
+	int nbits;		/* BITS_ACTIVE_S, BITS_ACTIVE_L, or BITS_UPLINK */
+	unsigned long pos;	/* see dedup_seen() */
+	unsigned char data[BITS_UPLINK/8];
+	unsigned char rel[BITS_UPLINK/8];
+	unsigned char out[BITS_UPLINK/8];
+	int bad;		/* codewords that FEC failed */
+	int fixed;		/* symbols corrected by FEC */
+	int done;		/* decoded, ready to print */
+};
+
+#define NFRAMES          64
+#define FEC_THREADS_MAX  16
+
+struct pipeline {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond_fec;	/* a frame to decode, or closed */
+	pthread_cond_t cond_out;	/* a frame is decoded, or closed */
+	pthread_cond_t cond_free;	/* a slot in frame[] is free */
+	unsigned long seq_in;		/* next frame from the slicer */
+	unsigned long seq_fec;		/* next frame to decode */
+	unsigned long seq_out;		/* next frame to print */
+	unsigned long pos_scan;		/* the slicer is done with it */
+	int closed;
+	unsigned int fixed;		/* collected by rx_stats() */
+	struct frame frame[NFRAMES];
+	pthread_t out_thread;
+	pthread_t fec_thread[FEC_THREADS_MAX];
 };
 
-struct fbuf {
-	double *buf;
-	unsigned int len;
+/*
+ * What the scan keeps between the buffers, live or replayed.
+ */
+struct rx_state {
+	struct source *src;
+	struct slicer sstate;
+	struct ss_stat stats;
+	unsigned long total;	/* samples before this round of stats */
+	unsigned long drops_mark, lost_mark, slow_mark;
 };
 
+/*
+ * The reliability of a bit is how close its delta_phi is to the nominal
+ * deviation: 255 right on it, 0 at the 500 kHz limit in scan_iq.
+ */
+#define CONF_NOMINAL  BA_FREQ(UAT_MOD)
+#define CONF_SPAN     (BA_FREQ(500000) - BA_FREQ(UAT_MOD))
+#define CONF_K        ((255 * 65536 + CONF_SPAN/2) / CONF_SPAN)
+
 static void preload_phi(void);
 static void init_field(void);
-static void alloc_fbuf(struct fbuf bufv[]);
-static void rx_callback(unsigned char *buf, uint32_t len, void *ctx);
-static void *rx_worker(void *arg);
+static void rx_run(struct source *srcp);
+static void rx_begin(struct rx_state *rsp, struct source *srcp);
+static void rx_end(struct rx_state *rsp);
+static void rx_scan(struct rx_state *rsp, const unsigned char *p, size_t len);
+static unsigned long rx_clock(const struct rx_state *rsp);
+static void rx_stats(struct rx_state *rsp, unsigned long t);
+static void out_start(void);
+static void out_stop(void);
 static void stats_dump(struct ss_stat *sp, unsigned long t);
 static void stats_reset(struct ss_stat *sp, unsigned long t);
-static int to_phi(double *fbuf, unsigned char *buf, int len);
 static void scan_init(struct scan *ssp);
-static void scan_fbuf(struct scan *ssp, struct ss_stat *stp, struct fbuf *p);
-static void scan_spill(struct scan *ssp, struct ss_stat *stp, int ended);
-static void scan_endbuf_save(struct scan *ssp, char *s, unsigned int wanted);
-static void packet_active_short(char *bits);
-static void packet_active_long(char *bits);
-static void packet_uplink(char *bits);
+static void slicer_init(struct slicer *slp);
+static void scan_iq(struct slicer *slp, struct ss_stat *stp,
+    const unsigned char *buf, unsigned int len);
+static void scan_bit(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    int good, unsigned int bit, unsigned int conf);
+static void scan_byte(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    unsigned int bits, const unsigned char *conf);
+static void scan_soft(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    int good, int delta_phi, unsigned int conf);
+static void scan_take(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    unsigned int bit, unsigned int conf);
+static int sync_corr(const struct scan *ssp);
+static void scan_frame(struct scan *ssp, struct ss_stat *stp);
+static uint64_t bits_get64(const uint64_t *bits, unsigned int off);
+static unsigned int pick8(unsigned int m);
+static void bits_put(struct scan *ssp, unsigned int v, int n);
+static void pack_bits(unsigned char *dst, const uint64_t *bits,
+    unsigned int off, int nbytes);
+static void pack_conf(unsigned char *dst, const unsigned char *conf,
+    int nbytes);
+static int maxeras(const struct rs_code *rc);
+static int dedup_seen(unsigned long pos, const unsigned char *data, int len);
+static int dedup_near(unsigned long pos);
+static void dedup_add(unsigned long pos, const unsigned char *data, int len);
+static void sync_count(struct ss_stat *stp, unsigned long pos, int bwanted,
+    int errs);
+static void pipe_start(void);
+static void pipe_stop(void);
+static void pipe_mark(unsigned long pos);
+static void pipe_submit(struct ss_stat *stp, const struct scan *ssp,
+    int nbits);
+static void *pipe_fec(void *arg);
+static void *pipe_out(void *arg);
+static void frame_fill(struct frame *fp, const struct scan *ssp, int nbits);
+static void frame_decode(struct frame *fp);
+static int frame_print(const struct frame *fp);
+static void frame_flush(unsigned long pos);
+static void fail_print(int nbits, int bad);
+static void frame_serve(const struct frame *fp, const unsigned char *p,
+    int dlen, int flen, int ncw);
 static void params(struct param *, int argc, char **argv);
 static void Usage(void);
-static int nearest_gain(int target_gain, rtlsdr_dev_t *dev);
 
 /*
- * Phi buffers are very large, so we keep NBUFS as low as possible
- * without getting the "No buffs" message. The number of USB buffers
- * in librtlsdr.c is 15, but it's unclear if we need to match that.
+ * The scan takes the I/Q samples as they are, so the buffers of the
+ * source are only as large as the USB ones. They used to be 1 MB arrays
+ * of phi in double, and only 5 of them.
+ */
+static const struct source_ops *const sources[] = {
+	&source_rtlsdr, &source_cu8, &source_synth, NULL
+};
+
+/*
+ * All of our stdout goes through the writer once the worker starts.
+ * The longest line is a raw Uplink: the sign, 2 hex digits for every
+ * byte, the semicolon, " fec=", and the newline.
  */
-#define NBUFS  5
-#define FBUF_DIM  (DEFAULT_BUF_LENGTH / 2)
+#define OUT_BATCH  (64*1024)
+#define LINE_MAX_U  (2*BITS_UPLINK/8 + 8)
+static struct writer out_w;
 
-/* Could easily pass these as an argument to rx_worker, but meh. */
-static pthread_mutex_t rx_mutex;
-static pthread_cond_t rx_cond;
-static int rx_die;
-static int rx_nbufs, rx_in, rx_out;
-static struct fbuf rx_bufs[NBUFS];
+/*
+ * The frames also go to the clients of our sockets, see frame_serve().
+ */
+static struct server srv;
 
 static struct param par;
 #if 1
-static double iq_to_phi[256][256];
+static unsigned short iq_to_phi[256][256];
 #endif
-static struct gf field;
-static unsigned char gpoly_up[21];
-static unsigned char gpoly_as[12];
-static unsigned char gpoly_al[14];
+static struct rs_code code_up, code_as, code_al;
+static struct dedup dedup;
+static struct sync_mark sync_mark;
+static struct pipeline pipe_line;
 
 int main(int argc, char **argv)
 {
-	unsigned int device_count, devx;
-	char manuf[BUF_MAX], prod[BUF_MAX], sernum[BUF_MAX];
-	int ppm_error = 0;
-	unsigned int real_rate;
-	int gain;
-	rtlsdr_dev_t *dev;
-	pthread_t rx_thread;
+	static struct source src;
+	struct source_conf conf;
+	struct source_stats st;
+	struct timeval t0, t1;
+	unsigned long usec;
 	int rc;
 
-	pthread_mutex_init(&rx_mutex, NULL);
-	pthread_cond_init(&rx_cond, NULL);
-
 	params(&par, argc, argv);
 
 	preload_phi();
 	init_field();
-	alloc_fbuf(rx_bufs);
-
-	device_count = rtlsdr_get_device_count();
-	if (!device_count) {
-		fprintf(stderr, TAG ": No supported devices found\n");
-		exit(1);
-	}
-	printf("Devices found: %u\n", device_count);
-
-	devx = 0;
-	printf("Using device: %s\n", rtlsdr_get_device_name(devx));
-
-	rc = rtlsdr_open(&dev, devx);
-	if (rc < 0) {
-		fprintf(stderr, TAG ": Error opening device %d: %d\n",
-		    devx, rc);
+	if (serve_init(&srv) != 0) {
+		fprintf(stderr, TAG ": Unable to start the server\n");
 		exit(1);
 	}
-
-	rc = rtlsdr_get_usb_strings(dev, manuf, prod, sernum);
-	if (rc < 0) {
-		fprintf(stderr, TAG ": Error getting strings: %d\n", rc);
-		exit(1);
-	}
-	printf("  %d:  %s, %s, SN: %s\n", devx, manuf, prod, sernum);
-
-	rc = rtlsdr_set_tuner_gain_mode(dev, 0);
-	if ((gain = par.gain) == (~0)) {
-		rc = rtlsdr_set_tuner_gain_mode(dev, 0);
-		if (rc < 0) {
-			fprintf(stderr,
-			    TAG ": Error setting auto gain: %d\n", rc);
-			exit(1);
-		}
-	} else {
-		rc = rtlsdr_set_tuner_gain_mode(dev, 1);
-		gain = nearest_gain(gain * 10, dev);
-		rc = rtlsdr_set_tuner_gain(dev, gain);
-		if (rc < 0) {
-			fprintf(stderr,
-			    TAG ": Error setting gain %d/10: %d\n", gain, rc);
+	for (rc = 0; rc < par.nlisten; rc++) {
+		if (serve_listen(&srv, par.listen[rc].addr,
+		    par.listen[rc].kind) != 0) {
+			fprintf(stderr, TAG ": Unable to listen at `%s'\n",
+			    par.listen[rc].addr);
 			exit(1);
 		}
-		printf("Gain set to %d\n", gain/10);
-	}
-
-	rtlsdr_set_agc_mode(dev, 1);
-
-	rc = rtlsdr_set_center_freq(dev, UAT_FREQ);
-	if (rc < 0) {
-		fprintf(stderr,
-		    TAG ": Error setting center frequency: %d\n", rc);
-		exit(1);
-	}
-
-	rc = rtlsdr_set_freq_correction(dev, ppm_error);
-	if (rc == -2) {
-		; /* same correction already in effect */
-	} else if (rc < 0) {
-		fprintf(stderr, TAG ": Error setting correction: %d\n", rc);
-		exit(1);
-	} else {
-		printf("Correction set to %d\n", rc);
 	}
 
-	rc = rtlsdr_set_sample_rate(dev, UAT_RATE);
-	if (rc < 0) {
-		fprintf(stderr, TAG ": Error setting rate: %d\n", rc);
+	memset(&conf, 0, sizeof(conf));
+	conf.format = SOURCE_CU8;
+	conf.rate = UAT_RATE;
+	conf.freq = UAT_FREQ;
+	conf.gain = par.gain;
+	if (source_open(&src, sources, par.source, &conf) != 0) {
+		fprintf(stderr, TAG ": Unable to open source `%s'\n",
+		    par.source);
 		exit(1);
 	}
-	real_rate = rtlsdr_get_sample_rate(dev);
-	printf("Sample rate set to %u (desired %d)\n", real_rate, UAT_RATE);
-	if (real_rate < UAT_RATE - UAT_RATE/544 ||
-	    real_rate > UAT_RATE + UAT_RATE/544) {
-		fprintf(stderr, TAG ": Set rate %u not acceptable, need %d\n",
-		    real_rate, UAT_RATE);
+	if (src.format != SOURCE_CU8) {
+		fprintf(stderr, TAG ": Source `%s' is not I/Q bytes\n",
+		    par.source);
 		exit(1);
 	}
 
-	/* Reset endpoint before we start reading from it (mandatory) */
-	rc = rtlsdr_reset_buffer(dev);
-	if (rc < 0) {
-		fprintf(stderr, TAG ": Error resetting: %d\n", rc);
+	out_start();
+	/* A file or the generator waits for us, so every line counts */
+	if (!src.live)
+		writer_block(&out_w, 1);
+	if (source_start(&src) != 0) {
+		fprintf(stderr, TAG ": Unable to start source `%s'\n",
+		    par.source);
 		exit(1);
 	}
 
-	rc = pthread_create(&rx_thread, NULL, rx_worker, NULL);
-	if (rc != 0) {
-		fprintf(stderr, TAG ": Error in pthread_create: %d\n", rc);
-		exit(1);
+	gettimeofday(&t0, NULL);
+	rx_run(&src);
+	gettimeofday(&t1, NULL);
+
+	source_stats(&src, &st);
+	source_stop(&src);
+	source_close(&src);
+	out_stop();
+
+	/* Without a device, the speed is what we want to know */
+	if (!src.live) {
+		usec = (t1.tv_sec - t0.tv_sec) * 1000000 +
+		    (t1.tv_usec - t0.tv_usec);
+		if (usec == 0)
+			usec = 1;
+		fprintf(stderr,
+		    TAG ": %lu samples in %lu.%06lu s, %.0f samples/s\n",
+		    st.samples, usec / 1000000, usec % 1000000,
+		    (double) st.samples * 1000000 / usec);
 	}
-
-#if 1
-	/* Flushing is cargo-culted from rtl_adsb. */
-	sleep(1);
-	rtlsdr_read_sync(dev, NULL, 4096, NULL);
-#endif
-
-	rtlsdr_read_async(dev, rx_callback, NULL, 0, DEFAULT_BUF_LENGTH);
-
-	pthread_mutex_lock(&rx_mutex);
-	rx_die = 1;
-	pthread_mutex_unlock(&rx_mutex);
-	rtlsdr_close(dev);
-	pthread_cond_signal(&rx_cond);
-
 	return 0;
 }
 
-static void rx_callback(unsigned char *buf, uint32_t len, void *ctx)
-{
-	struct fbuf *p;
-
-	pthread_mutex_lock(&rx_mutex);
-
-	if (rx_nbufs >= NBUFS) {
-		pthread_mutex_unlock(&rx_mutex);
-		fprintf(stderr, TAG ": No buffs\n");
-		return;
-	}
-
-	p = &rx_bufs[rx_in];
-	if (++rx_in == NBUFS) rx_in = 0;
-
-	p->len = to_phi(p->buf, buf, len);
-
-	rx_nbufs++;
-
-	pthread_cond_signal(&rx_cond);
-	pthread_mutex_unlock(&rx_mutex);
-}
-
 /*
  * Computing phi in-place: CPU 44%, RES 7742.
  * Precomputing phi here: CPU 9%, RES 17372.
  * You'd think that the program would be larger by 524288 bytes or so, but no.
  * It's actually 9.3 MB bigger. But you cannot argue with the CPU savings.
  * So much for the effects of caches and the memory wall.
+ * With binary angles, the table is 128 KB instead of 512 KB.
  */
 static void preload_phi(void)
 {
@@ -307,140 +413,152 @@ static void preload_phi(void)
 		for (vq = 0; vq < 256; vq++) {
 			/* V = Inphase + j*Quadrature; atan2(y,x) */
 			phi = atan2((double) (vq - 127), (double) (vi - 127));
-			iq_to_phi[vi][vq] = phi;
+			iq_to_phi[vi][vq] = BA_RAD(phi);
 		}
 	}
 }
 
 static void init_field(void)
 {
-	int rc;
-
-	rc = gf_init(&field, GF256_POLY_UAT);
-	if (rc != 0) {
-		fprintf(stderr, TAG ": gf_init(0x%x) error: %d\n",
-		    GF256_POLY_UAT, rc);
-		exit(1);
-	}
-
 	/*
+	 * The field and the generator polynomials come from gftab.c,
+	 * so all we do here is to select the kernels and make the codes.
+	 *
 	 * Ann 10 vol III, 12.4.4.2.2.2.1:
 	 * The generator polynomial shall be as follows:
 	 *   (x - alpha^120)*(x - alpha^121)* ... *(x - alpha^139)
-	 *
-	 * For some odd reason we supply 140 instead of 139 to p_gen_gen().
 	 */
-	rc = p_gen_gen(&field, gpoly_up, 120, 140);
-	if (rc != 0) {
-		/* This should not occur if the builder has run "make check". */
-		fprintf(stderr, TAG ": gf_gen_gen(0x%x,120,140) error: %d\n",
-		    GF256_POLY_UAT, rc);
-		exit(1);
-	}
-
-	rc = p_gen_gen(&field, gpoly_as, 120, 132);
-	if (rc != 0) {
-		fprintf(stderr, TAG ": gf_gen_gen(0x%x,120,132) error: %d\n",
-		    GF256_POLY_UAT, rc);
-		exit(1);
-	}
+	gf_simd(-1);
 
-	rc = p_gen_gen(&field, gpoly_al, 120, 134);
-	if (rc != 0) {
-		fprintf(stderr, TAG ": gf_gen_gen(0x%x,120,134) error: %d\n",
-		    GF256_POLY_UAT, rc);
+	/*
+	 * The codes are RS(92,72), RS(30,18), and RS(48,34), so they can
+	 * correct 10, 6, and 7 symbols respectively.
+	 */
+	if (rs_code_init(&code_up, &gf_uat, gpoly_uat_up, 92, 20, 120) != 0 ||
+	    rs_code_init(&code_as, &gf_uat, gpoly_uat_as, 30, 12, 120) != 0 ||
+	    rs_code_init(&code_al, &gf_uat, gpoly_uat_al, 48, 14, 120) != 0) {
+		fprintf(stderr, TAG ": rs_code_init error\n");
 		exit(1);
 	}
 }
 
 /*
- * We pass know the size of buffers in rtlsdr_read_async(),
- * sp we never run outside of the preallocated phi buffers.
+ * Scan everything the source has. A device only ends if it's gone,
+ * but a file or the generator ends, and then the rest of the stats
+ * is printed too.
  */
-static void alloc_fbuf(struct fbuf bufv[])
+static void rx_run(struct source *srcp)
 {
-	struct fbuf *p;
-	int i;
-
-	p = bufv;
-	for (i = 0; i < NBUFS; i++) {
-		p->buf = malloc(sizeof(double) * FBUF_DIM);
-		if (p->buf == NULL) {
-			fprintf(stderr, TAG ": No core\n");
-			exit(1);
-		}
-		p->len = 0;
-		p++;
+	struct rx_state rs;
+	const void *p;
+	size_t len;
+
+	rx_begin(&rs, srcp);
+	while (source_get(srcp, &p, &len, -1) > 0) {
+		rx_scan(&rs, p, len);
+		source_put(srcp);
 	}
+	rx_end(&rs);
+	if (!srcp->live && rs.stats.samples != 0)
+		rx_stats(&rs, rx_clock(&rs));
 }
 
-static void *rx_worker(void *arg)
+static void rx_begin(struct rx_state *rsp, struct source *srcp)
 {
-	struct scan sstate;
-	struct ss_stat stats;
-	struct timeval now;
-	struct fbuf *p;
-	unsigned long t;
-	int rc;
-
-	gettimeofday(&now, NULL);
-	t = (unsigned long)now.tv_sec * 1000000 + now.tv_usec;
-	stats_reset(&stats, t);
+	memset(rsp, 0, sizeof(struct rx_state));
+	rsp->src = srcp;
+	stats_reset(&rsp->stats, rx_clock(rsp));
+	slicer_init(&rsp->sstate);
+	pipe_start();
+}
 
-	scan_init(&sstate);
+/*
+ * Flush the pipeline, so that rx_stats() can count everything.
+ */
+static void rx_end(struct rx_state *rsp)
+{
+	pipe_stop();
+}
 
-	pthread_mutex_lock(&rx_mutex);
-	for (;;) {
-		if (rx_die)
-			break;
-		if (rx_nbufs == 0) {
-			rc = pthread_cond_wait(&rx_cond, &rx_mutex);
-			if (rc != 0) {
-				pthread_mutex_unlock(&rx_mutex);
-				fprintf(stderr,
-				    TAG ": Internal error 3: %d\n", rc);
-				// break;
-				exit(1);
-			}
-			if (rx_die)
-				break;
-			if (rx_nbufs == 0)
-				continue;
-		}
+static void rx_scan(struct rx_state *rsp, const unsigned char *p, size_t len)
+{
+	unsigned long t;
 
-		p = &rx_bufs[rx_out];
-		pthread_mutex_unlock(&rx_mutex);
+	scan_iq(&rsp->sstate, &rsp->stats, p, len);
+	pipe_mark(rsp->sstate.pos);
+	t = rx_clock(rsp);
+	if (t - rsp->stats.mark >= par.dump_interval*1000000)
+		rx_stats(rsp, t);
+}
 
-		scan_fbuf(&sstate, &stats, p);
+/*
+ * Microseconds: of the wall clock live, and of the samples otherwise.
+ */
+static unsigned long rx_clock(const struct rx_state *rsp)
+{
+	struct timeval now;
 
-		gettimeofday(&now, NULL);
-		t = (unsigned long)now.tv_sec * 1000000 + now.tv_usec;
-		if (t - stats.mark >= par.dump_interval*1000000) {
-			stats_dump(&stats, t);
-			stats_reset(&stats, t);
-		}
+	if (!rsp->src->live)
+		return (rsp->total + rsp->stats.samples) * 1000000 / UAT_RATE;
+	gettimeofday(&now, NULL);
+	return (unsigned long)now.tv_sec * 1000000 + now.tv_usec;
+}
 
-		pthread_mutex_lock(&rx_mutex);
-		if (rx_nbufs == 0) {
-			pthread_mutex_unlock(&rx_mutex);
-			fprintf(stderr, TAG ": Internal error 1\n");
-			exit(1);
-		}
+static void rx_stats(struct rx_state *rsp, unsigned long t)
+{
+	struct ss_stat *stp = &rsp->stats;
+	struct source_stats st;
+
+	source_stats(rsp->src, &st);
+	stp->drops = st.drops - rsp->drops_mark;
+	rsp->drops_mark += stp->drops;
+	stp->lost = writer_drops(&out_w) - rsp->lost_mark;
+	rsp->lost_mark += stp->lost;
+	stp->slow = serve_slow(&srv) - rsp->slow_mark;
+	rsp->slow_mark += stp->slow;
+	stp->fixed += __atomic_exchange_n(&pipe_line.fixed, 0,
+	    __ATOMIC_RELAXED);
+	stats_dump(stp, t);
+	rsp->total += stp->samples;
+	stats_reset(stp, t);
+}
 
-		if (++rx_out == NBUFS) rx_out = 0;
-		--rx_nbufs;
+/*
+ * All of our stdout goes through the writer from here on.
+ */
+static void out_start(void)
+{
+	fflush(stdout);
+	if (writer_init(&out_w, 1, OUT_BATCH, par.latency) != 0) {
+		fprintf(stderr, TAG ": Unable to start the writer\n");
+		exit(1);
 	}
-	pthread_mutex_unlock(&rx_mutex);
-	return NULL;
+	if (par.nlisten != 0 && serve_start(&srv) != 0) {
+		fprintf(stderr, TAG ": Unable to start the server\n");
+		exit(1);
+	}
+}
+
+static void out_stop(void)
+{
+	writer_fini(&out_w);
+	serve_fini(&srv);
 }
 
 static void stats_dump(struct ss_stat *sp, unsigned long t)
 {
+	char line[200];
+	int len;
 
-	printf("Samples %lu dT %lu"
-	    " Bits %lu Maxlen %lu Syncs a:%u u:%u\n",
+	len = snprintf(line, sizeof(line), "Samples %lu dT %lu"
+	    " Bits %lu Maxlen %lu Syncs a:%u u:%u (fuzzy %u) Fixed %u"
+	    " Drops %lu Lost %lu Slow %lu\n",
 	    sp->samples, t - sp->mark,
-	    sp->goodbits, sp->goodlen, sp->goodsynca, sp->goodsyncu);
+	    sp->goodbits, sp->goodlen, sp->goodsynca, sp->goodsyncu,
+	    sp->fuzzsync, sp->fixed, sp->drops, sp->lost, sp->slow);
+	if (len >= sizeof(line))
+		len = sizeof(line) - 1;
+	writer_put(&out_w, line, len);
 }
 
 static void stats_reset(struct ss_stat *sp, unsigned long t)
@@ -449,438 +567,954 @@ static void stats_reset(struct ss_stat *sp, unsigned long t)
 	sp->mark = t;
 }
 
-/*
- * Convert I/Q samples to angles and stash them in a buffer
- * where sync searches can access them several times.
- *  fbuf: return buffer
- *  buf: I/Q samples
- *  len: length of samples in bytes (2 bytes per sample)
- *  returns: number of numbers in fbuf
- */
-static int to_phi(double *fbuf, unsigned char *buf, int len)
-{
-	int cnt;
-	double phi;
-
-	cnt = 0;
-	while (len >= 2) {
-#if 0
-		int v;
-		double vi, vq;
-
-		/*
-		 * No need to normalize to 1.0 because we're about to divide.
-		 * XXX What about 00 = -1.0, 0xff = +1.0, thus zero at 127.5?
-		 */
-		v = *buf++;
-		vi = (double) (v - 127);
-		v = *buf++;
-		vq = (double) (v - 127);
-		phi = atan2(vq, vi);		/* V = Inphase + j*Quadrature */
-#endif
-#if 1
-		int vi, vq;
-
-		vi = *buf++;
-		vq = *buf++;
-		phi = iq_to_phi[vi][vq];
-#endif
-		fbuf[cnt++] = phi;
-		len -= 2;
-	}
-	return cnt;
-}
-
 static void scan_init(struct scan *ssp)
 {
 	memset(ssp, 0, sizeof(struct scan));
-	ssp->bits = malloc(BITS_LEN);
-	if (ssp->bits == NULL) {
+	ssp->bits = malloc(BITS_WORDS * sizeof(uint64_t));
+	ssp->conf = malloc(BITS_LEN);
+	if (ssp->bits == NULL || ssp->conf == NULL) {
 		fprintf(stderr, TAG ": No core\n");
 		exit(1);
 	}
 }
 
-/*
- * Scan a phi buffer for the sync bit sequence, push packets downchain
- *
- *  ssp: persistent state
- *  stp: persistent stats
- *  p: the input buffer
- *
- * XXX Only searching half of signals for now!
- */
-static void scan_fbuf(struct scan *ssp, struct ss_stat *stp, struct fbuf *p)
+static void slicer_init(struct slicer *slp)
 {
-	double delta_phi, mod_dphi;
-	double phi1, phi2;
-	int x;
-
-	x = 0;
+	memset(slp, 0, sizeof(struct slicer));
+	scan_init(&slp->phase[0]);
+	scan_init(&slp->phase[1]);
+}
 
-	stp->samples += p->len;
+/*
+ * The slicer limits for delta_phi, see scan_iq().
+ */
+#define DPHI_MIN  BA_FREQ(150000)
+#define DPHI_MAX  BA_FREQ(500000)
 
-	for (;;) {
-		/* XXX This only works as long as length is always even. */
-		if (x >= p->len)
-			break;
-		phi1 = p->buf[x++];
+/*
+ * Get 64 bits starting at the bit offset off.
+ */
+static uint64_t bits_get64(const uint64_t *bits, unsigned int off)
+{
+	unsigned int i = off >> 6;
+	unsigned int sh = off & 63;
 
-		if (x >= p->len)
-			break;
-		phi2 = p->buf[x++];
+	if (sh == 0)
+		return bits[i];
+	return (bits[i] << sh) | (bits[i+1] >> (64 - sh));
+}
 
-		/*
-		 * Let's find if the frequency went lower or higher than
-		 * the center, accounting for the modulo 2*pi.
-		 *
-		 * Chris Moody writes: "In practice, however, because the
-		 * filtering for bandwidth limitation introduces some
-		 * overshoot in the deviation, the maximum deviation is
-		 * closer to ±450 kHz."
-		 *
-		 * So, for now we use made-up constraints instead of UAT_MOD.
-		 */
-		delta_phi = phi2 - phi1;
-		if (delta_phi < -M_PI) {
-			delta_phi += 2*M_PI;
-		} else if (delta_phi > M_PI) {
-			delta_phi -= 2*M_PI;
-		}
-		mod_dphi = fabs(delta_phi);
-		if (mod_dphi < (150000.0/(float)UAT_RATE) * 2*M_PI ||
-		    mod_dphi > (500000.0/(float)UAT_RATE) * 2*M_PI) {
-			if (ssp->bfill != 0)
-				scan_spill(ssp, stp, 1);
-			ssp->runlen = 0;
-			continue;
-		}
-		stp->goodbits++;
-		if (++(ssp->runlen) > stp->goodlen) stp->goodlen = ssp->runlen;
-
-		if (ssp->bfill >= BITS_LEN) {
-			scan_spill(ssp, stp, 0);
-			if (ssp->bfill >= BITS_LEN) {
-				/* Never happens because we spilled */
-				fprintf(stderr, TAG ": Internal error 2\n");
-				exit(1);
-			}
-		}
-		ssp->bits[ssp->bfill++] = (delta_phi < 0) ? '0' : '1';
-	}
-	// scan_spill(ssp, stp, 0);
+/*
+ * Gather every other bit of a 16-bit mask into a byte, first bit in the MSB.
+ */
+static unsigned int pick8(unsigned int m)
+{
+	m &= 0x5555;
+	m = (m | (m >> 1)) & 0x3333;
+	m = (m | (m >> 2)) & 0x0f0f;
+	m = (m | (m >> 4)) & 0x00ff;
+	m = ((m & 0xf0) >> 4) | ((m & 0x0f) << 4);
+	m = ((m & 0xcc) >> 2) | ((m & 0x33) << 2);
+	m = ((m & 0xaa) >> 1) | ((m & 0x55) << 1);
+	return m;
 }
 
 /*
- * Spill the scan buffer
+ * Scan I/Q samples for the sync bit sequence, push packets downchain
  *
- *  ssp: persistent state
+ *  slp: persistent state
  *  stp: persistent stats
- *  ended: this spill was invoked by a bad bit, no more contiguous bits
+ *  buf: I/Q samples
+ *  len: length of samples in bytes (2 bytes per sample)
  *
- * At this point, the bit buffer contains a contiguous string of bits.
- * It may be long enough to contain several packets.
+ * This goes from the samples to bits in one pass: every sample is looked
+ * up in iq_to_phi[] and makes a delta_phi with the previous one, even
+ * across the buffers, and the deltas alternate between the two phases.
  *
- * Before returning, we must reduce bfill (else we loop or crash).
+ * Let's find if the frequency went lower or higher than the center.
+ * The modulo 2*pi is the wrap-around of the short.
+ *
+ * Chris Moody writes: "In practice, however, because the filtering for
+ * bandwidth limitation introduces some overshoot in the deviation, the
+ * maximum deviation is closer to ±450 kHz."
+ *
+ * So, for now we use made-up constraints instead of UAT_MOD.
+ *
+ * In MODE_CORR, the limits only count for the stats, see scan_soft().
  */
-static void scan_spill(struct scan *ssp, struct ss_stat *stp, int ended)
+static void scan_iq(struct slicer *slp, struct ss_stat *stp,
+    const unsigned char *buf, unsigned int len)
 {
-	const char sync_bits_a[] = "111010101100110111011010010011100010";
-	const char sync_bits_u[] = "000101010011001000100101101100011101";
-	char *end = ssp->bits + ssp->bfill;
-	char *s;
-	size_t off;
+	struct scan *ssp;
+	int delta_phi, mod_dphi;
+	unsigned short phi1, phi2;
+	int conf;
+	unsigned int x;
 
-	off = 0;
-	if (ssp->bwanted) {
-		if (ssp->bfill < ssp->bwanted) {
-			if (!ended) {
-				/*
-				 * The packet is not ended, but we spilled.
-				 * This is an internal error, because we only
-				 * should spill when the bit buffer overflows,
-				 * and the size of it should be longer than
-				 * the longest packet.
-				 */
-				fprintf(stderr,
-				    TAG ": Internal error 4: %d %d\n",
-				    ssp->bfill, ssp->bwanted);
-				exit(1);
-				// return;
+	stp->samples += len / 2;
+
+	phi2 = slp->phi;
+	x = 0;
+#ifdef __SSE2__
+	/*
+	 * Slice 16 samples at a time: the compares produce masks of
+	 * the signs and of the limits, which PMOVMSKB turns into bits.
+	 * When all 8 bits of a phase are good, they go in as a byte.
+	 */
+	for (; x + 32 <= len; x += 32) {
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i dmin = _mm_set1_epi16(DPHI_MIN);
+		const __m128i dmax = _mm_set1_epi16(DPHI_MAX);
+		const __m128i nom = _mm_set1_epi16(CONF_NOMINAL);
+		const __m128i ck = _mm_set1_epi16(CONF_K);
+		const __m128i c255 = _mm_set1_epi16(255);
+		unsigned short ph[17];
+		short dv[16];
+		unsigned char cb[16];
+		__m128i d[2], a[2], c[2];
+		unsigned int negm, badm;
+		int h, k;
+
+		ph[0] = phi2;
+		for (k = 0; k < 16; k++)
+			ph[k+1] = iq_to_phi[buf[x + 2*k]][buf[x + 2*k + 1]];
+		phi2 = ph[16];
+
+		for (k = 0; k < 2; k++) {
+			d[k] = _mm_sub_epi16(
+			    _mm_loadu_si128((const __m128i *) (ph + 8*k + 1)),
+			    _mm_loadu_si128((const __m128i *) (ph + 8*k)));
+			a[k] = _mm_max_epi16(d[k], _mm_sub_epi16(zero, d[k]));
+			c[k] = _mm_sub_epi16(a[k], nom);
+			c[k] = _mm_max_epi16(c[k], _mm_sub_epi16(zero, c[k]));
+			c[k] = _mm_sub_epi16(c255, _mm_mulhi_epu16(c[k], ck));
+		}
+		negm = _mm_movemask_epi8(_mm_packs_epi16(
+		    _mm_cmplt_epi16(d[0], zero), _mm_cmplt_epi16(d[1], zero)));
+		badm = _mm_movemask_epi8(_mm_packs_epi16(
+		    _mm_or_si128(_mm_cmplt_epi16(a[0], dmin),
+		      _mm_cmpgt_epi16(a[0], dmax)),
+		    _mm_or_si128(_mm_cmplt_epi16(a[1], dmin),
+		      _mm_cmpgt_epi16(a[1], dmax))));
+		_mm_storeu_si128((__m128i *) cb, _mm_packus_epi16(c[0], c[1]));
+
+		if (par.mode == MODE_CORR) {
+			_mm_storeu_si128((__m128i *) dv, d[0]);
+			_mm_storeu_si128((__m128i *) (dv + 8), d[1]);
+			for (k = 0; k < 16; k++) {
+				scan_soft(&slp->phase[(slp->pos + k) & 1], stp,
+				    slp->pos + k + 1, !((badm >> k) & 1),
+				    dv[k], cb[k]);
 			}
-			/* A packet is truncated, restart scan */
-			ssp->bwanted = 0;
-			ssp->bfill = 0;
-			return;
+			slp->pos += 16;
+			continue;
 		}
-		/* We have a packet, print it, spill its bits, restart scan */
-		if (ssp->bwanted == BITS_UPLINK) {
-			packet_uplink(ssp->bits);
-			off = BITS_UPLINK;
-		} else if (ssp->bwanted == BITS_ACTIVE_L) {
-			packet_active_long(ssp->bits);
-			off = BITS_ACTIVE_L;
-		} else if (ssp->bwanted == BITS_ACTIVE_S) {
-			if (memcmp(ssp->bits, "00000", 5) == 0) {
-				packet_active_short(ssp->bits);
-				off = BITS_ACTIVE_S;
+		for (h = 0; h < 2; h++) {
+			ssp = &slp->phase[(slp->pos + h) & 1];
+			if (((badm >> h) & 0x5555) == 0) {
+				scan_byte(ssp, stp, slp->pos + 15 + h,
+				    pick8(~negm >> h), cb + h);
 			} else {
-				if (ssp->bfill >= BITS_ACTIVE_L) {
-					packet_active_long(ssp->bits);
-					off = BITS_ACTIVE_L;
-				} else {
-					/* junk bits */
-					off = 0;
+				for (k = h; k < 16; k += 2) {
+					scan_bit(ssp, stp, slp->pos + k + 1,
+					    !((badm >> k) & 1),
+					    !((negm >> k) & 1), cb[k]);
 				}
 			}
-		} else {
-			fprintf(stderr, TAG ": Internal error 6: %d\n",
-			    ssp->bwanted);
-			exit(1);
 		}
-		ssp->bwanted = 0;
+		slp->pos += 16;
 	}
-
-	s = ssp->bits + off;
-	for (;;) {
-		if (s + NBITS > end) {
-			if (ended) {
-				/* A few bits of junk, drop */
-				ssp->bfill = 0;
-			} else {
-				ssp->bfill = end - s;
-				if (s != ssp->bits && ssp->bfill != 0)
-					memmove(ssp->bits, s, ssp->bfill);
-			}
-			break;
-		}
-
-		if (memcmp(s, sync_bits_a, NBITS) == 0) {
-			stp->goodsynca++;
-			s += NBITS;
-			if (s + BITS_ACTIVE_S > end) {
-				if (ended) {
-					/* not even a short one - truncated */
-					ssp->bfill = 0;
-					break;
-				}
-				/*
-				 * We don't know which one this is yet,
-				 * ask short.
-				 */
-				scan_endbuf_save(ssp, s, BITS_ACTIVE_S);
-				break;
-			}
-			/*
-			 * Now we have to peek inside a packet that
-			 * is not error-corrected yet. Good job, ICAO.
-			 * See Doc.9861 2.1.2.
-			 */
-			if (memcmp(s, "00000", 5) == 0) {	/* short */
-				packet_active_short(s);
-				s += BITS_ACTIVE_S;
-			} else {				/* long */
-				if (s + BITS_ACTIVE_L > end) {
-					if (ended) {
-						/* truncated */
-						ssp->bfill = 0;
-						break;
-					}
-					scan_endbuf_save(ssp, s, BITS_ACTIVE_L);
-					break;
-				}
-				packet_active_long(s);
-				s += BITS_ACTIVE_L;
-			}
-		} else if (memcmp(s, sync_bits_u, NBITS) == 0) {
-			stp->goodsyncu++;
-			s += NBITS;
-			if (s + BITS_UPLINK > end) {
-				if (ended) {
-					/* An uplink packet is truncated */
-					ssp->bfill = 0;
-					break;
-				}
-				scan_endbuf_save(ssp, s, BITS_UPLINK);
-				break;
-			}
-			packet_uplink(s);
-			s += BITS_UPLINK;
+#endif
+	for (; x + 1 < len; x += 2) {
+		phi1 = phi2;
+		/* V = Inphase + j*Quadrature */
+		phi2 = iq_to_phi[buf[x]][buf[x + 1]];
+		ssp = &slp->phase[slp->pos & 1];
+		slp->pos++;
+
+		delta_phi = (short) (phi2 - phi1);
+		mod_dphi = abs(delta_phi);
+		conf = 255 - ((abs(mod_dphi - CONF_NOMINAL) * CONF_K) >> 16);
+		if (conf < 0)
+			conf = 0;
+		if (par.mode == MODE_CORR) {
+			scan_soft(ssp, stp, slp->pos,
+			    mod_dphi >= DPHI_MIN && mod_dphi <= DPHI_MAX,
+			    delta_phi, conf);
 		} else {
-			s++;
+			scan_bit(ssp, stp, slp->pos,
+			    mod_dphi >= DPHI_MIN && mod_dphi <= DPHI_MAX,
+			    delta_phi >= 0, conf);
 		}
 	}
+	slp->phi = phi2;
 }
 
 /*
- * We end here when we need more bits, but the bit buffer does not have them,
- * and the transmission has not ended yet. So, save the remaining bits
- * into the head of the buffer, and set ssp->wanted for the next time.
+ * Take one bit into a scan, or end the run of good bits
+ *
+ *  pos: the sample just after the bit
+ *  good: the bit is within the limits
  */
-static void scan_endbuf_save(struct scan *ssp, char *s, unsigned int wanted)
+static void scan_bit(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    int good, unsigned int bit, unsigned int conf)
 {
-	char *end = ssp->bits + ssp->bfill;
-
-	/*
-	 * This looks like we are checking for overlap, and this condition
-	 * looks like it may be valid. But the real objective here is to
-	 * guard against looping, which may only happen if we save more
-	 * than we process. Looping is a pain to debug. We make sure this
-	 * can never happen by keeping the bit buffer size longer than
-	 * 2 times the size of longest packet.
-	 */
-	if (end-s >= ssp->bfill) {
-		fprintf(stderr, TAG ": Internal error 5: %d %ld\n",
-		    ssp->bfill, (long)(end-s));
-		exit(1);
+	if (!good) {
+		/* A packet is truncated, if any, restart the sync */
+		ssp->bwanted = 0;
+		ssp->bfill = 0;
+		ssp->sfill = 0;
+		ssp->runlen = 0;
+		return;
 	}
-
-	ssp->bfill = end - s;
-	memmove(ssp->bits, s, ssp->bfill);
-	ssp->bwanted = wanted;
+	stp->goodbits++;
+	if (++(ssp->runlen) > stp->goodlen) stp->goodlen = ssp->runlen;
+	scan_take(ssp, stp, pos, bit, conf);
 }
 
-static void packet_active_short(char *bits)
+/*
+ * Same as scan_bit() for 8 good bits at once
+ *
+ *  pos: the sample just after the last bit
+ *  bits: first bit in the MSB
+ *  conf: reliabilities, in every other byte
+ */
+static void scan_byte(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    unsigned int bits, const unsigned char *conf)
 {
-	unsigned char packet[BITS_ACTIVE_S/8];
-	int i;
-	unsigned char buf[12];
-
-	for (i = 0; i < BITS_ACTIVE_S/8; i++) {
-		packet[i] = PICK_BYTE(bits); bits += 8;
+	unsigned char *cp;
+	int j;
+
+	stp->goodbits += 8;
+	ssp->runlen += 8;
+	if (ssp->runlen > stp->goodlen) stp->goodlen = ssp->runlen;
+
+	if (ssp->bwanted == 0 || ssp->bfill + 8 > ssp->bwanted) {
+		/* Looking for the sync, or the packet ends inside */
+		for (j = 0; j < 8; j++)
+			scan_take(ssp, stp, pos - 2*(7 - j),
+			    (bits >> (7 - j)) & 1, conf[2*j]);
+		return;
 	}
-	if (par.raw) {
-		printf("-");
-		for (i = 0; i < 18; i++)
-			printf("%02x", packet[i]);
-		printf(";");
-		printf(" fec=");
-		for (i = 0; i < 12; i++) {
-			printf("%02x", packet[18 + i]);
-		}
-		printf("\n");
-		fflush(stdout);
-	} else {
-		p_rem(&field, buf, 12, 18, packet, gpoly_as);
-		if (memcmp(buf, packet + 18, 12) == 0) {
-			printf("-");
-			for (i = 0; i < 18; i++)
-				printf("%02x", packet[i]);
-			printf(";\n");
-			fflush(stdout); /* needed for timely updates in Glie */
-		} else {
-			printf("as\n");
+	cp = ssp->conf + ssp->bfill;
+	for (j = 0; j < 8; j++)
+		cp[j] = conf[2*j];
+	bits_put(ssp, bits, 8);
+	ssp->pos = pos;
+	if (ssp->bfill == ssp->bwanted)
+		scan_frame(ssp, stp);
+}
+
+/*
+ * Take one bit into a scan in MODE_CORR
+ *
+ *  pos: the sample just after the bit
+ *  good: the bit is within the limits, only for the stats
+ *  delta_phi: the signed phase step of the bit
+ *
+ * Here every bit counts, whether it's in the limits or not. The sync
+ * is the matched filter: the last NBITS delta_phi are correlated with
+ * the +1/-1 of the sync word. When a weak signal knocks a bit or two
+ * of a run out of the limits, the correlation hardly notices, and the
+ * payload is sliced by the sign, with the reliabilities sorting out the
+ * rest. The correlation is only computed for the candidates that are
+ * within CORR_GATE bit errors, which the noise rarely is.
+ */
+static void scan_soft(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    int good, int delta_phi, unsigned int conf)
+{
+	unsigned int bit = delta_phi >= 0;
+	int d, c;
+
+	if (good) {
+		stp->goodbits++;
+		if (++(ssp->runlen) > stp->goodlen)
+			stp->goodlen = ssp->runlen;
+	} else {
+		ssp->runlen = 0;
+	}
+
+	if (ssp->bwanted != 0) {
+		scan_take(ssp, stp, pos, bit, conf);
+		return;
+	}
+
+	/* A quiet channel goes on for hours, so sfill stops at NBITS */
+	ssp->dring[ssp->dpos++ & 63] = delta_phi;
+	ssp->sreg = (ssp->sreg << 1) | bit;
+	if (ssp->sfill < NBITS)
+		ssp->sfill++;
+	if (ssp->sfill < NBITS)
+		return;
+	d = __builtin_popcountll((ssp->sreg ^ SYNC_A) & SYNC_MASK);
+	if (d > CORR_GATE && d < NBITS - CORR_GATE)
+		return;
+	c = sync_corr(ssp);
+	if (c >= CORR_THRESH) {
+		ssp->bwanted = BITS_ACTIVE_S;
+	} else if (c <= -CORR_THRESH) {
+		ssp->bwanted = BITS_UPLINK;
+		d = NBITS - d;
+	} else {
+		return;
+	}
+	sync_count(stp, pos, ssp->bwanted, d);
+	ssp->bfill = 0;
+}
+
+/*
+ * The normalized correlation of the last NBITS delta_phi with SYNC_A,
+ * in percent. It's the same with SYNC_U, only negative.
+ */
+static int sync_corr(const struct scan *ssp)
+{
+	int64_t sum, energy;
+	int v, i;
+
+	sum = 0;
+	energy = 0;
+	for (i = 0; i < NBITS; i++) {
+		v = ssp->dring[(ssp->dpos - NBITS + i) & 63];
+		if ((SYNC_A >> (NBITS - 1 - i)) & 1)
+			sum += v;
+		else
+			sum -= v;
+		energy += v * v;
+	}
+	if (energy == 0)
+		return 0;
+	/* sum / sqrt(NBITS * energy), without the square root */
+	v = (int) sqrt((double) sum * sum * 10000 / (NBITS * energy));
+	return (sum < 0) ? -v : v;
+}
+
+/*
+ * Take one good bit: look for the sync, or add the bit to the packet
+ *
+ * Every bit goes through the shift register and is compared with both
+ * sync words at once, so this is a shift, an XOR and a popcount per bit.
+ * Up to par.syncerrs bits of the sync may be wrong. Once we are in sync,
+ * the bits go into bits[], until there's a whole packet.
+ */
+static void scan_take(struct scan *ssp, struct ss_stat *stp, unsigned long pos,
+    unsigned int bit, unsigned int conf)
+{
+	int d;
+
+	if (ssp->bwanted == 0) {
+		ssp->sreg = (ssp->sreg << 1) | bit;
+		if (ssp->sfill < NBITS)
+			ssp->sfill++;
+		if (ssp->sfill < NBITS)
+			return;
+		d = __builtin_popcountll((ssp->sreg ^ SYNC_A) & SYNC_MASK);
+		if (d <= par.syncerrs) {
+			/*
+			 * We don't know which one this is yet,
+			 * ask short, see scan_frame().
+			 */
+			ssp->bwanted = BITS_ACTIVE_S;
+		} else if (d >= NBITS - par.syncerrs) {
+			ssp->bwanted = BITS_UPLINK;
+			d = NBITS - d;
+		} else {
+			return;
+		}
+		sync_count(stp, pos, ssp->bwanted, d);
+		ssp->bfill = 0;
+		return;
+	}
+
+	ssp->conf[ssp->bfill] = conf;
+	bits_put(ssp, bit, 1);
+	ssp->pos = pos;
+	if (ssp->bfill == ssp->bwanted)
+		scan_frame(ssp, stp);
+}
+
+/*
+ * Both phases may sync on the same burst, a sample or two apart, and
+ * it's counted only once, same as its frame is printed once.
+ */
+static void sync_count(struct ss_stat *stp, unsigned long pos, int bwanted,
+    int errs)
+{
+	if (sync_mark.bwanted == bwanted &&
+	    pos - sync_mark.pos <= DEDUP_WINDOW)
+		return;
+	sync_mark.pos = pos;
+	sync_mark.bwanted = bwanted;
+
+	if (bwanted == BITS_UPLINK)
+		stp->goodsyncu++;
+	else
+		stp->goodsynca++;
+	if (errs != 0)
+		stp->fuzzsync++;
+}
+
+/*
+ * The scan has all the bits it wanted, push the packet downchain
+ *
+ * The bits of the packet are at the head of bits[], and ssp->pos is
+ * the sample just after its last bit.
+ */
+static void scan_frame(struct scan *ssp, struct ss_stat *stp)
+{
+	if (ssp->bwanted == BITS_ACTIVE_S) {
+		/*
+		 * Now we have to peek inside a packet that
+		 * is not error-corrected yet. Good job, ICAO.
+		 * See Doc.9861 2.1.2.
+		 */
+		if ((ssp->bits[0] >> 59) != 0) {
+			/* Long, keep going */
+			ssp->bwanted = BITS_ACTIVE_L;
+			return;
+		}
+		pipe_submit(stp, ssp, BITS_ACTIVE_S);
+	} else if (ssp->bwanted == BITS_ACTIVE_L ||
+	    ssp->bwanted == BITS_UPLINK) {
+		pipe_submit(stp, ssp, ssp->bwanted);
+	} else {
+		fprintf(stderr, TAG ": Internal error 6: %d\n", ssp->bwanted);
+		exit(1);
+	}
+	ssp->bwanted = 0;
+	ssp->bfill = 0;
+	ssp->sfill = 0;
+}
+
+/*
+ * Append n bits of v, MSB first, to the bit buffer. The bits past bfill
+ * are kept zero, so we only need to OR them in.
+ */
+static void bits_put(struct scan *ssp, unsigned int v, int n)
+{
+	unsigned int i = ssp->bfill >> 6;
+	unsigned int sh = ssp->bfill & 63;
+
+	if (sh == 0)
+		ssp->bits[i] = 0;
+	if (sh + n <= 64) {
+		ssp->bits[i] |= (uint64_t) v << (64 - sh - n);
+	} else {
+		ssp->bits[i] |= (uint64_t) v >> (sh + n - 64);
+		ssp->bits[i+1] = (uint64_t) v << (128 - sh - n);
+	}
+	ssp->bfill += n;
+}
+
+/*
+ * Pack the bits into bytes, 8 bytes for every 64-bit word.
+ */
+static void pack_bits(unsigned char *dst, const uint64_t *bits,
+    unsigned int off, int nbytes)
+{
+	uint64_t w;
+	int i, j;
+
+	for (i = 0; i < nbytes; i += 8) {
+		w = bits_get64(bits, off + i*8);
+		for (j = 0; j < 8 && i + j < nbytes; j++)
+			dst[i + j] = w >> (56 - j*8);
+	}
+}
+
+/*
+ * A byte is as reliable as its worst bit.
+ */
+static void pack_conf(unsigned char *dst, const unsigned char *conf,
+    int nbytes)
+{
+	unsigned int m;
+	int i, j;
+
+	for (i = 0; i < nbytes; i++) {
+		m = conf[0];
+		for (j = 1; j < 8; j++) {
+			if (conf[j] < m)
+				m = conf[j];
 		}
+		dst[i] = m;
+		conf += 8;
+	}
+}
+
+static int maxeras(const struct rs_code *rc)
+{
+	return (par.maxeras < 0) ? rc->nroots / 2 : par.maxeras;
+}
+
+/*
+ * When a burst is aligned in between the two phases, both of them may
+ * decode it, so we only print a frame if it's not the same as one that
+ * ended a couple of samples apart.
+ */
+static int dedup_seen(unsigned long pos, const unsigned char *data, int len)
+{
+	int i;
+
+	for (i = 0; i < DEDUP_N; i++) {
+		if (dedup.frame[i].len == len &&
+		    pos - dedup.frame[i].pos + DEDUP_WINDOW <= 2*DEDUP_WINDOW &&
+		    memcmp(dedup.frame[i].data, data, len) == 0)
+			return 1;
 	}
+	dedup_add(pos, data, len);
+	return 0;
 }
 
-static void packet_active_long(char *bits)
+/*
+ * A failure is the same burst as any frame that ended nearby, whether
+ * the other phase decoded it or not.
+ */
+static int dedup_near(unsigned long pos)
 {
-	unsigned char packet[BITS_ACTIVE_L/8];
 	int i;
-	unsigned char buf[14];
 
-	for (i = 0; i < BITS_ACTIVE_L/8; i++) {
-		packet[i] = PICK_BYTE(bits); bits += 8;
+	for (i = 0; i < DEDUP_N; i++) {
+		if (pos - dedup.frame[i].pos + DEDUP_WINDOW <= 2*DEDUP_WINDOW)
+			return 1;
 	}
-	if (par.raw) {
-		printf("-");
-		for (i = 0; i < 34; i++)
-			printf("%02x", packet[i]);
-		printf(";");
-		printf(" fec=");
-		for (i = 0; i < 14; i++) {
-			printf("%02x", packet[34 + i]);
+	return 0;
+}
+
+static void dedup_add(unsigned long pos, const unsigned char *data, int len)
+{
+	int i;
+
+	i = dedup.next;
+	dedup.frame[i].pos = pos;
+	dedup.frame[i].len = len;
+	memcpy(dedup.frame[i].data, data, len);
+	dedup.next = (i + 1) % DEDUP_N;
+}
+
+/*
+ * The pipeline: the scan thread slices the bits and finds the frames,
+ * par.fec_threads threads decode them, and one thread prints them, in
+ * the order they were found. A burst of Uplinks, or a slow reader of our
+ * stdout, holds up only the stage that's busy, until NFRAMES are queued.
+ * After that, the scan stops, and the USB buffers pile up in the source.
+ *
+ * With no FEC threads, the scan thread does it all, one frame at a time.
+ */
+static void pipe_start(void)
+{
+	struct pipeline *plp = &pipe_line;
+	int i;
+	int rc;
+
+	if (par.fec_threads == 0)
+		return;
+
+	pthread_mutex_init(&plp->mutex, NULL);
+	pthread_cond_init(&plp->cond_fec, NULL);
+	pthread_cond_init(&plp->cond_out, NULL);
+	pthread_cond_init(&plp->cond_free, NULL);
+
+	for (i = 0; i < par.fec_threads; i++) {
+		rc = pthread_create(&plp->fec_thread[i], NULL, pipe_fec, plp);
+		if (rc != 0) {
+			fprintf(stderr,
+			    TAG ": Error in pthread_create: %d\n", rc);
+			exit(1);
 		}
-		printf("\n");
-		fflush(stdout);
-	} else {
-		p_rem(&field, buf, 14, 34, packet, gpoly_al);
-		if (memcmp(buf, packet + 34, 14) == 0) {
-			printf("-");
-			for (i = 0; i < 34; i++)
-				printf("%02x", packet[i]);
-			printf(";\n");
-			fflush(stdout); /* needed for timely updates in Glie */
+	}
+	rc = pthread_create(&plp->out_thread, NULL, pipe_out, plp);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": Error in pthread_create: %d\n", rc);
+		exit(1);
+	}
+}
+
+/*
+ * Let the pipeline drain, and wait for it.
+ */
+static void pipe_stop(void)
+{
+	struct pipeline *plp = &pipe_line;
+	int i;
+
+	if (par.fec_threads == 0) {
+		frame_flush(~0UL);
+		return;
+	}
+
+	pthread_mutex_lock(&plp->mutex);
+	plp->closed = 1;
+	pthread_cond_broadcast(&plp->cond_fec);
+	pthread_cond_broadcast(&plp->cond_out);
+	pthread_mutex_unlock(&plp->mutex);
+
+	for (i = 0; i < par.fec_threads; i++)
+		pthread_join(plp->fec_thread[i], NULL);
+	pthread_join(plp->out_thread, NULL);
+}
+
+/*
+ * Send the frame at the head of the bit buffer down the pipeline.
+ * Only the scan thread calls this, so the slot at seq_in is ours
+ * until we bump seq_in, and we fill it without the lock.
+ */
+static void pipe_submit(struct ss_stat *stp, const struct scan *ssp,
+    int nbits)
+{
+	struct pipeline *plp = &pipe_line;
+	struct frame frame, *fp;
+
+	if (par.fec_threads == 0) {
+		frame_fill(&frame, ssp, nbits);
+		frame_decode(&frame);
+		stp->fixed += frame_print(&frame);
+		return;
+	}
+
+	pthread_mutex_lock(&plp->mutex);
+	while (plp->seq_in - plp->seq_out >= NFRAMES)
+		pthread_cond_wait(&plp->cond_free, &plp->mutex);
+	fp = &plp->frame[plp->seq_in % NFRAMES];
+	pthread_mutex_unlock(&plp->mutex);
+
+	frame_fill(fp, ssp, nbits);
+
+	pthread_mutex_lock(&plp->mutex);
+	plp->seq_in++;
+	pthread_cond_signal(&plp->cond_fec);
+	pthread_mutex_unlock(&plp->mutex);
+}
+
+/*
+ * The slicer is done with the samples up to pos, so there's no frame
+ * ending before it that's not in the pipeline already.
+ */
+static void pipe_mark(unsigned long pos)
+{
+	struct pipeline *plp = &pipe_line;
+
+	if (par.fec_threads == 0) {
+		frame_flush(pos);
+		return;
+	}
+
+	pthread_mutex_lock(&plp->mutex);
+	plp->pos_scan = pos;
+	pthread_cond_signal(&plp->cond_out);
+	pthread_mutex_unlock(&plp->mutex);
+}
+
+static void *pipe_fec(void *arg)
+{
+	struct pipeline *plp = arg;
+	struct frame *fp;
+
+	pthread_mutex_lock(&plp->mutex);
+	for (;;) {
+		if (plp->seq_fec != plp->seq_in) {
+			fp = &plp->frame[plp->seq_fec++ % NFRAMES];
+			pthread_mutex_unlock(&plp->mutex);
+
+			frame_decode(fp);
+
+			pthread_mutex_lock(&plp->mutex);
+			fp->done = 1;
+			pthread_cond_signal(&plp->cond_out);
+		} else if (plp->closed) {
+			break;
+		} else {
+			pthread_cond_wait(&plp->cond_fec, &plp->mutex);
+		}
+	}
+	pthread_mutex_unlock(&plp->mutex);
+	return NULL;
+}
+
+static void *pipe_out(void *arg)
+{
+	struct pipeline *plp = arg;
+	struct frame *fp;
+	unsigned long mark;
+	int fixed;
+
+	mark = 0;
+	pthread_mutex_lock(&plp->mutex);
+	for (;;) {
+		fp = &plp->frame[plp->seq_out % NFRAMES];
+		if (plp->seq_out != plp->seq_in && fp->done) {
+			pthread_mutex_unlock(&plp->mutex);
+
+			fixed = frame_print(fp);
+			__atomic_fetch_add(&plp->fixed, fixed,
+			    __ATOMIC_RELAXED);
+
+			pthread_mutex_lock(&plp->mutex);
+			fp->done = 0;
+			plp->seq_out++;
+			pthread_cond_signal(&plp->cond_free);
+		} else if (plp->seq_out == plp->seq_in && plp->closed) {
+			break;
+		} else if (plp->seq_out == plp->seq_in &&
+		    plp->pos_scan != mark) {
+			/* All of the frames before it are printed */
+			mark = plp->pos_scan;
+			pthread_mutex_unlock(&plp->mutex);
+			frame_flush(mark);
+			pthread_mutex_lock(&plp->mutex);
 		} else {
-			printf("al\n");
+			pthread_cond_wait(&plp->cond_out, &plp->mutex);
 		}
 	}
+	pthread_mutex_unlock(&plp->mutex);
+	frame_flush(~0UL);
+	return NULL;
+}
+
+/*
+ * The frame is at the head of the bit buffer, and ssp->pos is the sample
+ * just after its last bit.
+ */
+static void frame_fill(struct frame *fp, const struct scan *ssp, int nbits)
+{
+	fp->nbits = nbits;
+	fp->pos = ssp->pos;
+	pack_bits(fp->data, ssp->bits, 0, nbits/8);
+	pack_conf(fp->rel, ssp->conf, nbits/8);
+	fp->bad = 0;
+	fp->fixed = 0;
+	fp->done = 0;
 }
 
 /*
  * See Annex 10 Volume III 12.4.4.2.2.3 for the interleaving procedure.
- *
- *  bits: A bit buffer of length BITS_UPLINK
+ * The 6 blocks are interleaved byte by byte, and rs_decode_ilv() takes
+ * them in this form, checks all of them in one pass, and deinterleaves.
  */
-static void packet_uplink(char *bits)
+static void frame_decode(struct frame *fp)
 {
-	unsigned char packet[BITS_UPLINK/8], *p;
-	unsigned char d;
-	int ecnt;
-	int i, j;
-	unsigned char buf[20];
+	const struct rs_code *rc;
+	int status[6];
+	int i;
 
-	for (i = 0; i < BITS_UPLINK/8; i++) {
-		d = PICK_BYTE(bits); bits += 8;
-		packet[(i%6) * (BITS_U_STEP/8) + (i/6)] = d;
+	if (fp->nbits == BITS_UPLINK) {
+		if (par.raw) {
+			rs_deinterleave(fp->out, fp->data, BITS_U_STEP/8, 6);
+			return;
+		}
+		fp->bad = rs_decode_ilv(&code_up, fp->out, fp->data, fp->rel,
+		    maxeras(&code_up), 6, status);
+		if (fp->bad == 0) {
+			for (i = 0; i < 6; i++)
+				fp->fixed += status[i];
+		}
+		return;
 	}
 
-	if (par.raw) {
-		printf("+");
-		for (i = 0; i < 6; i++) {
-			p = packet + i*92;
-			for (j = 0; j < 72; j++) {
-				printf("%02x", p[j]);
-			}
-		}
-		printf(";");
-		printf(" fec=");
-		for (i = 0; i < 6; i++) {
-			p = packet + i*92 + 72;
-			for (j = 0; j < 20; j++) {
-				printf("%02x", p[j]);
-			}
+	if (par.raw)
+		return;
+	rc = (fp->nbits == BITS_ACTIVE_S) ? &code_as : &code_al;
+	if (rs_check(rc, fp->data)) {
+		fp->fixed = rs_decode_soft(rc, fp->data, fp->rel,
+		    maxeras(rc));
+		if (fp->fixed < 0) {
+			fp->fixed = 0;
+			fp->bad = 1;
 		}
-		printf("\n");
+	}
+}
+
+/*
+ * Print a decoded frame, unless we've seen it already. Returns the number
+ * of symbols that FEC corrected in it, if it was printed. A failure is
+ * only printed if neither phase got the burst, see frame_flush().
+ *
+ * The line is put together in hex here, and the writer thread takes it
+ * from there, see writer.h. There's no flush: the writer sends it out
+ * within par.latency, which is right away by default. This is needed
+ * for timely updates in Glie.
+ */
+static int frame_print(const struct frame *fp)
+{
+	char line[LINE_MAX_U];
+	const unsigned char *p;
+	char *lp;
+	int dlen, flen;		/* data and FEC bytes, per codeword */
+	int ncw;		/* codewords */
+	int i;
+
+	if (fp->nbits == BITS_UPLINK) {
+		p = fp->out;
+		dlen = 72;
+		flen = 20;
+		ncw = 6;
 	} else {
-		ecnt = 0;
-		for (i = 0; i < 6; i++) {
-			p = packet + i*92;
-			p_rem(&field, buf, 20, 72, p, gpoly_up);
-			if (memcmp(buf, p + 72, 20) != 0) {
-				ecnt += 1;
-			}
+		p = fp->data;
+		dlen = (fp->nbits == BITS_ACTIVE_S) ? 18 : 34;
+		flen = (fp->nbits == BITS_ACTIVE_S) ? 12 : 14;
+		ncw = 1;
+	}
+
+	frame_flush(fp->pos);
+	if (fp->bad) {
+		if (!dedup_near(fp->pos)) {
+			dedup_add(fp->pos, fp->data, 0);
+			dedup.fail.pos = fp->pos;
+			dedup.fail.nbits = fp->nbits;
+			dedup.fail.bad = fp->bad;
 		}
+		return 0;
+	}
+	/* The other phase failed on it */
+	dedup.fail.nbits = 0;
+	if (dedup_seen(fp->pos, p, fp->nbits/8))
+		return 0;
 
-		if (ecnt == 0) {
-			printf("+");
-			for (i = 0; i < 6; i++) {
-				p = packet + i*92;
-				for (j = 0; j < 72; j++)
-					printf("%02x", p[j]);
-			}
-			printf(";\n");
-			fflush(stdout);
-		} else {
-			printf("u %d\n", ecnt);
+	lp = line;
+	*lp++ = (fp->nbits == BITS_UPLINK) ? '+' : '-';
+	for (i = 0; i < ncw; i++)
+		lp = hex_put(lp, p + i*(dlen + flen), dlen);
+	*lp++ = ';';
+	if (par.raw) {
+		memcpy(lp, " fec=", 5);
+		lp += 5;
+		for (i = 0; i < ncw; i++)
+			lp = hex_put(lp, p + i*(dlen + flen) + dlen, flen);
+	}
+	*lp++ = '\n';
+	writer_put(&out_w, line, lp - line);
+
+	if (serve_wants(&srv, SERVE_TEXT)) {
+		/* Same as dump978, that is, ours without FEC and with rs= */
+		lp = (char *) memchr(line, ';', lp - line) + 1;
+		lp += sprintf(lp, "rs=%d;\n", fp->fixed);
+		serve_publish(&srv, SERVE_TEXT, line, lp - line);
+	}
+	if (serve_wants(&srv, SERVE_BIN))
+		frame_serve(fp, p, dlen, flen, ncw);
+	return fp->fixed;
+}
+
+/*
+ * Print the failure that is held, once there can be no frame from the
+ * other phase of the same burst, that is, no frame that ends before pos.
+ */
+static void frame_flush(unsigned long pos)
+{
+	if (dedup.fail.nbits == 0 ||
+	    pos - dedup.fail.pos + DEDUP_WINDOW <= 2*DEDUP_WINDOW)
+		return;
+	fail_print(dedup.fail.nbits, dedup.fail.bad);
+	dedup.fail.nbits = 0;
+}
+
+static void fail_print(int nbits, int bad)
+{
+	char line[8];
+	int len;
+
+	if (nbits == BITS_UPLINK)
+		len = snprintf(line, sizeof(line), "u %d\n", bad);
+	else if (nbits == BITS_ACTIVE_S)
+		len = snprintf(line, sizeof(line), "as\n");
+	else
+		len = snprintf(line, sizeof(line), "al\n");
+	writer_put(&out_w, line, len);
+}
+
+/*
+ * The binary protocol is a stream of records, every one a header and
+ * the bytes of a frame. All fields are big-endian.
+ *
+ *   0  u16  length of the record, header included
+ *   2  u8   type: 1 ADS-B short, 2 ADS-B long, 3 Uplink
+ *   3  u8   symbols corrected by FEC, 255 if more
+ *   4  u64  sample number where the frame ends, at UAT_RATE
+ *  12  u16  level, the mean reliability of the bits, 0 to 65535
+ *  14       the frame: data bytes only, and the Uplink is deinterleaved;
+ *           with -r, the data and FEC of every codeword, as printed
+ *
+ * There's no RSSI in ruat, but the reliability of bits tracks the SNR,
+ * see pack_conf(), which is about as good for telling weak frames apart.
+ * Bad frames and the stats are not sent.
+ */
+#define SREC_HDR   14
+#define SREC_AS     1
+#define SREC_AL     2
+#define SREC_UP     3
+
+static void frame_serve(const struct frame *fp, const unsigned char *p,
+    int dlen, int flen, int ncw)
+{
+	unsigned char rec[SREC_HDR + BITS_UPLINK/8];
+	unsigned char *rp;
+	unsigned long sum;
+	unsigned int level;
+	int len, i;
+
+	rp = rec + SREC_HDR;
+	if (par.raw) {
+		memcpy(rp, p, fp->nbits/8);
+		rp += fp->nbits/8;
+	} else {
+		for (i = 0; i < ncw; i++) {
+			memcpy(rp, p + i*(dlen + flen), dlen);
+			rp += dlen;
 		}
 	}
+	len = rp - rec;
+
+	sum = 0;
+	for (i = 0; i < fp->nbits/8; i++)
+		sum += fp->rel[i];
+	level = sum * 257 / (fp->nbits/8);
+
+	rec[0] = len >> 8;
+	rec[1] = len;
+	if (fp->nbits == BITS_UPLINK)
+		rec[2] = SREC_UP;
+	else
+		rec[2] = (fp->nbits == BITS_ACTIVE_S) ? SREC_AS : SREC_AL;
+	rec[3] = (fp->fixed > 255) ? 255 : fp->fixed;
+	for (i = 0; i < 8; i++)
+		rec[4 + i] = (uint64_t) fp->pos >> (56 - 8*i);
+	rec[12] = level >> 8;
+	rec[13] = level;
+	serve_publish(&srv, SERVE_BIN, rec, len);
 }
 
 static void params(struct param *par, int argc, char **argv)
 {
-	char *arg;
+	char *arg, *spec;
 	long n;
+	int kind;
 
+	par->source = "rtlsdr";
 	par->gain = (~0);
 	par->raw = 0;
 	par->dump_interval = 10;
+	par->maxeras = -1;
+	par->syncerrs = 2;
+	par->mode = MODE_RUN;
+	par->fec_threads = 2;
+	par->latency = 0;
+	par->nlisten = 0;
 
 	argv += 1;
 	while ((arg = *argv++) != NULL) {
 		if (arg[0] == '-') {
-			if (arg[1] == 'd') {
+			if (arg[1] == 'B' || arg[1] == 'T') {
+				kind = (arg[1] == 'B') ? SERVE_BIN : SERVE_TEXT;
+				if ((arg = *argv++) == NULL)
+					Usage();
+				if (par->nlisten >= SERVE_MAXL) {
+					fprintf(stderr,
+					    TAG ": Too many listeners\n");
+					exit(1);
+				}
+				par->listen[par->nlisten].addr = arg;
+				par->listen[par->nlisten].kind = kind;
+				par->nlisten++;
+			} else if (arg[1] == 'd') {
 				if ((arg = *argv++) == NULL)
 					Usage();
 				n = strtol(arg, NULL, 10);
@@ -889,6 +1523,31 @@ static void params(struct param *par, int argc, char **argv)
 				if (n >= 24*60*60)
 					n = 24*60*60;
 				par->dump_interval = n;
+			} else if (arg[1] == 'e') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				/*
+				 * Past t of a code, the false frames grow
+				 * fast, and past its parity less 2,
+				 * rs_decode_soft() clamps it, see README.
+				 */
+				n = strtol(arg, NULL, 10);
+				if (n < 0 || n > ERAS_MAX) {
+					fprintf(stderr,
+					    TAG ": Invalid erasures `%s'\n", arg);
+					exit(1);
+				}
+				par->maxeras = n;
+			} else if (arg[1] == 'f') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				/* Same as -i cu8:file, from before the sources */
+				if ((spec = malloc(strlen(arg) + 5)) == NULL) {
+					fprintf(stderr, TAG ": No core\n");
+					exit(1);
+				}
+				sprintf(spec, "cu8:%s", arg);
+				par->source = spec;
 			} else if (arg[1] == 'g') {
 				if ((arg = *argv++) == NULL)
 					Usage();
@@ -899,8 +1558,56 @@ static void params(struct param *par, int argc, char **argv)
 					exit(1);
 				}
 				par->gain = n;
+			} else if (arg[1] == 'i') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				par->source = arg;
+			} else if (arg[1] == 'j') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				n = strtol(arg, NULL, 10);
+				if (n < 0 || n > FEC_THREADS_MAX) {
+					fprintf(stderr,
+					    TAG ": Invalid FEC threads `%s'\n",
+					    arg);
+					exit(1);
+				}
+				par->fec_threads = n;
+			} else if (arg[1] == 'l') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				n = strtol(arg, NULL, 10);
+				if (n < 0 || n > 10000) {
+					fprintf(stderr,
+					    TAG ": Invalid latency `%s'\n", arg);
+					exit(1);
+				}
+				par->latency = n;
+			} else if (arg[1] == 'm') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				if (strcmp(arg, "run") == 0) {
+					par->mode = MODE_RUN;
+				} else if (strcmp(arg, "corr") == 0) {
+					par->mode = MODE_CORR;
+				} else {
+					fprintf(stderr,
+					    TAG ": Invalid mode `%s'\n", arg);
+					exit(1);
+				}
 			} else if (arg[1] == 'r') {
 				par->raw = 1;
+			} else if (arg[1] == 's') {
+				if ((arg = *argv++) == NULL)
+					Usage();
+				n = strtol(arg, NULL, 10);
+				if (n < 0 || n > SYNC_ERRS_MAX) {
+					fprintf(stderr,
+					    TAG ": Invalid sync errors `%s'\n",
+					    arg);
+					exit(1);
+				}
+				par->syncerrs = n;
 			} else {
 				Usage();
 			}
@@ -912,29 +1619,14 @@ static void params(struct param *par, int argc, char **argv)
 
 static void Usage(void)
 {
-	fprintf(stderr, "Usage: " TAG " [-r] [-d interval] [-g gain]\n");
+	fprintf(stderr, "Usage: " TAG " [-r] [-d interval] [-g gain]"
+	    " [-e max_erasures] [-s sync_errors] [-m run|corr]"
+	    " [-j fec_threads] [-l latency_ms]\n"
+	    "       [-B port|path] [-T port|path] [-i source] [-f capture.cu8|-]\n"
+	    "Sources: rtlsdr[:index] cu8:file|- synth[:seconds[,snr_db]]\n"
+	    "Erasures: t of each code by default (6, 7, 10); more trades false"
+	    " frames for yield,\n"
+	    "       up to %d, and each code takes at most its parity less 2\n",
+	    ERAS_MAX);
 	exit(1);
 }
-
-/* taken from rtl_rm */
-static int nearest_gain(int target_gain, rtlsdr_dev_t *dev)
-{
-	int i, err1, err2, count, close_gain;
-	int* gains;
-	count = rtlsdr_get_tuner_gains(dev, NULL);
-	if (count <= 0) {
-		return 0;
-	}
-	gains = malloc(sizeof(int) * count);
-	count = rtlsdr_get_tuner_gains(dev, gains);
-	close_gain = gains[0];
-	for (i=0; i<count; i++) {
-		err1 = abs(target_gain - close_gain);
-		err2 = abs(target_gain - gains[i]);
-		if (err2 < err1) {
-			close_gain = gains[i];
-		}
-	}
-	free(gains);
-	return close_gain;
-}
@@ -7,16 +7,15 @@
  * for details.
  */
 #include <math.h>
-#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/time.h>
 
-#include <airspy.h>
-
 #include "fec.h"
+#include "fir.h"
+#include "source.h"
 #include "upd.h"
 
 #include "phasetab.h"
@@ -26,8 +25,20 @@
 #define UAT_FREQ  978000000	/* carrier or center frequency, Doc 9861 2.2 */
 #define UAT_MOD      312500	/* notional modulation */
 #define UAT_RATE    1041667	/* 25 bits in every 24 microseconds */
+#define AIRSPY_RATE  20000000	/* real samples, before we mix them by fs/4 */
+#define SCAN_RATE  (AIRSPY_RATE / FIR_M * FIR_L)	/* I/Q out of fir_run() */
+
+/*
+ * Phase angles are binary, 2*pi is 65536, see phasegen.py.
+ * So, a difference of angles is always modulo 2*pi in unsigned short.
+ */
+#define BA_PI       32768
+#define BA_FREQ(hz)   ((int) ((hz) * 65536.0 / SCAN_RATE + 0.5))
 
 struct param {
+	const char *source;	/* see source.h */
+	int packed;		/* ask Airspy for 12-bit samples */
+	unsigned int nbufs;	/* transfers that the ring holds */
 	int mode_capture;
 	int lna_gain;
 	int mix_gain;
@@ -38,9 +49,13 @@ struct param {
 enum bit_state { BIT_HUNT, BIT_GAP, BIT_BODY };
 struct rx_state {
 	// int fs4_osc;		// 0 <= fs4_osc < 4
-	struct upd uavg_i, uavg_q;
-	float prev_phi;
-	float prev_delta;
+	struct upd_lvl lvl;
+	struct upd_sums run;	/* of the run of bits, up to the last buffer */
+	int run_len;		/* pairs in run */
+	unsigned long burst_cnt;
+	long long burst_pow;	/* sum of the mean power of the bursts */
+	unsigned short prev_phi;
+	int prev_good;
 
 	unsigned long hgram[HGLEN];
 	unsigned long hgram_e1, hgram_e2;
@@ -51,44 +66,53 @@ struct rx_state {
 };
 
 /*
- * The limit macros implement the "25 bits in 240 samples" ratio schedule
+ * The limit macros implement the "25 bits in 50 samples" ratio schedule
  * for inter-bit gaps and bit "bodies". Notice that the zero is where the
- * initial body presumably starts. The one-bit offset is there to account
- * for the round-down behavior of integer division in C.
+ * initial body presumably starts. At 2 samples per bit, the gap is the
+ * sample that straddles the edge of the bit, and the body is the one
+ * that does not.
+ */
+#define VAL_LIM_BODY_0  1
+#define VAL_LIM_GAP(bitcnt)  ((bitcnt)*2)
+#define VAL_LIM_BODY(bitcnt) ((bitcnt)*2 + 1)
+
+/*
+ * With one good sample in a bit, its sign cannot be checked against the
+ * one before it. Instead, the step of the phase has to be about that of
+ * the deviation, same as in the slicer of ruat.
  */
-#define VAL_LIM_BODY_0  5
-#define VAL_LIM_GAP(bitcnt)  (((bitcnt)*240)/25 + 1)
-#define VAL_LIM_BODY(bitcnt) (((bitcnt)*240)/25 + 6)
+#define DPHI_MIN  BA_FREQ(150000)
+#define DPHI_MAX  BA_FREQ(500000)
 
 /* XXX temporary */
 #define HDR_LEN  1000
 
-struct rx_counts {
-	unsigned long c_nocore;
-	unsigned long c_bufdrop;
-	unsigned long c_bufcnt;
-};
+/*
+ * The levels are of a tenth of a second, and a run of bits as long as
+ * the last bucket of the histogram is taken for a burst.
+ */
+#define LVL_WINDOW  (SCAN_RATE / 10)
+#define BURST_BITS  HGLEN
 
-struct packet {
-	struct packet *next;
-	int num;		// number of complex samples
-	int *buf;		// XXX make these short
-};
+/* The most transfers in the ring of Airspy, 64 MB worth */
+#define NBUFS_MAX  256
 
 static int rx_state_init(struct rx_state *rsp);
-static void rx_state_fini(struct rx_state *rsp);
-static void scan_buf(struct rx_state *rsp, struct packet *pp);
+static void scan_buf(struct rx_state *rsp, const int *p, int num);
 static void hgram_one(struct rx_state *rsp, int bitnum);
-static void dump_buf(struct rx_state *rsp, struct packet *pp);
-static void timer_print(
-    unsigned long bufcnt, unsigned long bufdrop, unsigned long nocore,
+static void burst_one(struct rx_state *rsp, const int *p, int num,
+    int bitcnt);
+static void dump_buf(struct rx_state *rsp, const int *p, int num);
+static void timer_print(unsigned long bufcnt, unsigned long bufdrop,
     struct rx_state *rsp);
+static double lvl_db(double power);
 static void parse(struct param *p, char **argv);
 static void Usage(void);
-static int rx_callback(airspy_transfer_t *xfer);
-static unsigned int dc_bias_update(unsigned char *sp);
+static int convert(const unsigned char *sp, int n, int *bp);
+static unsigned int dc_bias_update(const unsigned char *sp, int packed);
 
 static struct param par;
+static struct fir fir;
 
 /*
  * We're treating the offset by 0x800 as a part of the DC bias.
@@ -97,278 +121,169 @@ static struct param par;
 static unsigned int dc_bias = 0x800;
 static unsigned int bias_timer;
 
-#define PMAX  20
+/*
+ * The raw samples are converted a chunk at a time, into an int for
+ * every I and Q after the filter. Packed, 8 samples are in 12 bytes,
+ * so a chunk is whole groups of 8.
+ */
+#define CVT_SAMPLES  (128*1024)
+static int cvt_buf[FIR_OUT_MAX(CVT_SAMPLES)];
 
-static pthread_mutex_t rx_mutex;
-static pthread_cond_t rx_cond;
-unsigned int pcnt;
-struct packet *phead, *ptail;
-struct rx_counts c_stat;
+static const struct source_ops *const sources[] = {
+	&source_airspy, &source_raw16, &source_raw12, &source_synth, NULL
+};
 
 int main(int argc, char **argv)
 {
-	struct airspy_device *device = NULL;
-	int (*rx_cb)(airspy_transfer_t *xfer);
+	static struct source src;
+	struct source_conf conf;
+	struct source_stats st;
 	int stop = 0;
 	int cap_skip = 0;
 	static struct rx_state rxstate;
 	struct timeval count_last, now;
+	unsigned long bufcnt, drops_mark, bufdrop, samples_mark;
+	const unsigned char *bp;
+	size_t len, off, nsamples;
+	int packed;
+	int m, n;
 	int rc;
 
 	parse(&par, argv);
 
 	if (rx_state_init(&rxstate) != 0) {
-		fprintf(stderr, TAG ": upd_init() failed: No core\n");
-		/* leaks a little bit but we're bailing anyway */
+		fprintf(stderr, TAG ": upd_lvl_init() failed\n");
 		goto err_upd;
 	}
 
-	rc = airspy_init();
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_init() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_init;
-	}
-
-	// open any device, result by reference
-	rc = airspy_open(&device);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_open() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
+	memset(&conf, 0, sizeof(conf));
+	conf.format = par.packed ? SOURCE_RAW12 : SOURCE_RAW16;
+	conf.rate = AIRSPY_RATE;
+	conf.freq = UAT_FREQ;
+	conf.lna_gain = par.lna_gain;
+	conf.mix_gain = par.mix_gain;
+	conf.vga_gain = par.vga_gain;
+	conf.nbufs = par.nbufs;
+	if (source_open(&src, sources, par.source, &conf) != 0) {
+		fprintf(stderr, TAG ": Unable to open source `%s'\n",
+		    par.source);
 		goto err_open;
 	}
-
-	rc = airspy_set_sample_type(device, AIRSPY_SAMPLE_RAW);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr,
-		    TAG ": airspy_set_sample_type() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_sample;
+	if (src.format != SOURCE_RAW16 && src.format != SOURCE_RAW12) {
+		fprintf(stderr, TAG ": Source `%s' is not raw Airspy\n",
+		    par.source);
+		goto err_format;
 	}
-
-	rc = airspy_set_samplerate(device, 0);	// set by index, rate 20m
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr,
-		    TAG ": airspy_set_samplerate() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_rate;
+	packed = (src.format == SOURCE_RAW12);
+	if (fir_init(&fir, CVT_SAMPLES, packed) != 0) {
+		fprintf(stderr, TAG ": fir_init() failed: No core\n");
+		goto err_fir;
 	}
-
-	// Packing: 1 - 12 bits, 0 - 16 bits
-	rc = airspy_set_packing(device, 0);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_set_packing() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_packed;
-	}
-
-	// Not sure why this is not optional
-	rc = airspy_set_rf_bias(device, 0);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_set_rf_bias() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_bias;
-	}
-
-	// VGA is "Variable Gain Amplifier": the exit amplifier after mixer
-	// and filter in R820T.
-	//
-	// Default in airspy_rx is 5; rtl-sdr sets 11 (26.5 dB) FWIW.
-	// We experimented a little, and leave 12 for now.
-	//
-	// Register address: 0x0c
-	// 0x80  unused, set 1
-	// 0x40  VGA power:     0 off, 1 on
-	// 0x20  unused, set 1
-	// 0x10  VGA mode:      0 gain control by VAGC pin,
-	//                      1 gain control by code in this register
-	// 0x0f  VGA gain code: 0x0 -12 dB, 0xf +40.5 dB, with -3.5dB/step
-	//
-	// The software only transfers the value 0..15. Firmware sets the rest.
-	rc = airspy_set_vga_gain(device, par.vga_gain);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr,
-		    TAG ": airspy_set_vga_gain() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-	}
-
-	// Mixer has its own gain. Not sure how that works, perhaps relative
-	// to the oscillator signal.
-	//
-	// Default in airspy_rx is 5; rtl-sdr does 0x10 to enable auto.
-	//
-	// Register address: 0x07
-	// 0x80  unused, set 0
-	// 0x40  Mixer power:   0 off, 1 on
-	// 0x20  Mixer current: 0 max current, 1 normal current
-	// 0x10  Mixer mode:    0 manual mode, 1 auto mode
-	// 0x0f  manual gain level
-	//
-	// The software only transfers the value 0..15. Firmware sets the rest.
-	rc = airspy_set_mixer_gain(device, par.mix_gain);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr,
-		    TAG ": airspy_set_mixer_gain() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-	}
-
-	// The LNA is the pre-amp at the receive frequency before mixing.
-	//
-	// The default in airspy_rx is 1.
-	//
-	// Register address: 0x05
-	// 0x80  Loop through:  0 on, 1 off  -- weird, backwards
-	// 0x40  unused, set 0
-	// 0x20  LNA1 Power:    0 on, 1 off
-	// 0x10  Auto gain:     0 auto, 1 manual
-	// 0x0F  manual gain level, 0 is min gain, 15 is max gain
-	//
-	// The software only transfers the value 0..14. Firmware sets the rest.
-	rc = airspy_set_lna_gain(device, par.lna_gain);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr,
-		    TAG ": airspy_set_lna_gain() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-	}
-
-	rx_cb = rx_callback;
-	rc = airspy_start_rx(device, rx_cb, NULL);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_start_rx() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
+	if (source_start(&src) != 0) {
+		fprintf(stderr, TAG ": Unable to start source `%s'\n",
+		    par.source);
 		goto err_start;
 	}
 
-	// No idea why the frequency is set after the start of the receiving
-	rc = airspy_set_freq(device, UAT_FREQ);
-	if (rc != AIRSPY_SUCCESS) {
-		fprintf(stderr, TAG ": airspy_set_freq() failed: %s (%d)\n",
-		    airspy_error_name(rc), rc);
-		goto err_freq;
-	}
-
 	gettimeofday(&count_last, NULL);
+	bufcnt = 0;
+	drops_mark = 0;
+	samples_mark = 0;
 
-	while (airspy_is_streaming(device) && !stop) {
-
-		pthread_mutex_lock(&rx_mutex);
-		while (pcnt) {
-			struct packet *pp;
-
-			--pcnt;
-			pp = phead;
-			phead = pp->next;
-			pthread_mutex_unlock(&rx_mutex);
+	while (!stop) {
 
+		/* Wake up once in a while to see if we're still streaming */
+		rc = source_get(&src, (const void **) &bp, &len, 1000);
+		if (rc < 0)
+			break;
+		if (rc == 0)
+			continue;
+
+		nsamples = packed ? len / 12 * 8 : len / 2;
+		for (off = 0; off < nsamples; off += m) {
+			m = nsamples - off;
+			if (m > CVT_SAMPLES)
+				m = CVT_SAMPLES;
+			n = convert(bp + (packed ? off / 8 * 12 : off * 2), m,
+			    cvt_buf);
 			if (par.mode_capture) {
-				if (++cap_skip >= 30 && !stop) {
-					dump_buf(&rxstate, pp);
+				if (++cap_skip >= 30) {
+					dump_buf(&rxstate, cvt_buf, n / 2);
 					stop = 1;
 					break;
 				}
 			} else {
-				scan_buf(&rxstate, pp);
-			}
-
-			free(pp->buf);
-			free(pp);
-
-			pthread_mutex_lock(&rx_mutex);
-			c_stat.c_bufcnt++;
-
-			gettimeofday(&now, NULL);
-			if (now.tv_sec >= count_last.tv_sec + 10) {
-				unsigned long bufcnt, bufdrop, nocore;
-
-				nocore = c_stat.c_nocore;
-				bufdrop = c_stat.c_bufdrop;
-				bufcnt = c_stat.c_bufcnt;
-				memset(&c_stat, 0, sizeof(struct rx_counts));
-
-				pthread_mutex_unlock(&rx_mutex);
-
-				timer_print(bufcnt, bufdrop, nocore, &rxstate);
-
-				count_last = now;
-				pthread_mutex_lock(&rx_mutex);
+				scan_buf(&rxstate, cvt_buf, n / 2);
 			}
 		}
-		rc = pthread_cond_wait(&rx_cond, &rx_mutex);
-		if (rc != 0) {
-			pthread_mutex_unlock(&rx_mutex);
-			fprintf(stderr,
-			   TAG "pthread_cond_wait() failed:"
-			   " %d\n", rc);
-			exit(1);
+		source_put(&src);
+		bufcnt++;
+
+		/* Without a device, the time is that of the samples */
+		source_stats(&src, &st);
+		gettimeofday(&now, NULL);
+		if (src.live ? now.tv_sec >= count_last.tv_sec + 10 :
+		    st.samples - samples_mark >= 10UL * AIRSPY_RATE) {
+			bufdrop = st.drops - drops_mark;
+			drops_mark += bufdrop;
+			timer_print(bufcnt, bufdrop, &rxstate);
+			bufcnt = 0;
+			count_last = now;
+			samples_mark = st.samples;
 		}
-		pthread_mutex_unlock(&rx_mutex);
+	}
+	if (!src.live && bufcnt != 0) {
+		source_stats(&src, &st);
+		timer_print(bufcnt, st.drops - drops_mark, &rxstate);
 	}
 
-	airspy_stop_rx(device);
-	airspy_close(device);
-	airspy_exit();
-
-	rx_state_fini(&rxstate);
+	source_stop(&src);
+	source_close(&src);
+	fir_fini(&fir);
 	return 0;
 
-err_freq:
-	airspy_stop_rx(device);
 err_start:
-err_bias:
-err_packed:
-err_rate:
-err_sample:
-	airspy_close(device);
+	fir_fini(&fir);
+err_fir:
+err_format:
+	source_close(&src);
 err_open:
-	airspy_exit();
-err_init:
-	rx_state_fini(&rxstate);
 err_upd:
 	return 1;
 }
 
 static int rx_state_init(struct rx_state *rsp)
 {
-	enum { AVGLEN = 200 };
-
-	if (upd_init(&rsp->uavg_i, AVGLEN) != 0)
-		goto err_i;
-	if (upd_init(&rsp->uavg_q, AVGLEN) != 0)
-		goto err_q;
-	rsp->prev_phi = 0.0;
+	if (upd_lvl_init(&rsp->lvl, LVL_WINDOW) != 0)
+		return -1;
+	memset(&rsp->run, 0, sizeof(struct upd_sums));
+	rsp->run_len = 0;
+	rsp->burst_cnt = 0;
+	rsp->burst_pow = 0;
+	rsp->prev_phi = 0;
+	rsp->prev_good = 0;
 
 	rsp->state = BIT_HUNT;
 	rsp->bitcnt = 0;
 	rsp->valcnt = 0;
 	return 0;
-
-err_q:
-	upd_fini(&rsp->uavg_i);
-err_i:
-	return -1;
-}
-
-static void rx_state_fini(struct rx_state *rsp)
-{
-	upd_fini(&rsp->uavg_i);
-	upd_fini(&rsp->uavg_q);
 }
 
-static void scan_buf(struct rx_state *rsp, struct packet *pp)
+static void scan_buf(struct rx_state *rsp, const int *p, int num)
 {
-	const int *p;
 	int i;
 	int x, y;
 	int x_comp, y_comp;
-	float phi;
-	float delta;
+	unsigned short phi;
+	unsigned short delta;
+	int good;
+	int start;		/* of the run of bits, or of this buffer */
 
-	p = pp->buf;
-	for (i = 0; i < pp->num; i++) {
+	/* The levels of the whole buffer, at once */
+	upd_lvl_run(&rsp->lvl, p, num);
 
-		/* I, Q */
-		upd_ate(&rsp->uavg_i, abs(p[0]));
-		upd_ate(&rsp->uavg_q, abs(p[1]));
+	start = 0;
+	for (i = 0; i < num; i++) {
 
 		x = p[0];
 		y = p[1];
@@ -380,26 +295,29 @@ static void scan_buf(struct rx_state *rsp, struct packet *pp)
 			phi = phi_tab[y_comp][x_comp];
 			break;
 		case 1:
-			phi = phi_tab[x_comp][y_comp] + M_PI*0.5;
+			phi = phi_tab[x_comp][y_comp] + BA_PI/2;
 			break;
 		case 3:
-			phi = phi_tab[y_comp][x_comp] + M_PI;
+			phi = phi_tab[y_comp][x_comp] + BA_PI;
 			break;
 		case 2:
-			phi = phi_tab[x_comp][y_comp] + M_PI*1.5;
+			phi = phi_tab[x_comp][y_comp] + BA_PI/2*3;
 		}
 
 		delta = phi - rsp->prev_phi;
-		if (delta < 0.0)
-			delta += 2*M_PI;
 		rsp->prev_phi = phi;
+		good = abs((short) delta) >= DPHI_MIN &&
+		    abs((short) delta) <= DPHI_MAX;
 
 		/*
 		 * assemble bits
 		 */
 		if (rsp->state == BIT_HUNT) {
-			if ((delta < M_PI && rsp->prev_delta < M_PI) ||
-			    (delta >= M_PI && rsp->prev_delta >= M_PI)) {
+			/*
+			 * A bad sample straddles an edge between two
+			 * different bits, so a good one after it is a body.
+			 */
+			if (good && !rsp->prev_good) {
 				if (++rsp->valcnt >= VAL_LIM_BODY_0) {
 					// bit_val = ..... (delta)
 					/*
@@ -407,6 +325,10 @@ static void scan_buf(struct rx_state *rsp, struct packet *pp)
 					 * Now start the schedule.
 					 */
 					rsp->bitcnt = 1;
+					start = i;
+					memset(&rsp->run, 0,
+					    sizeof(struct upd_sums));
+					rsp->run_len = 0;
 					/*
 					 * Change to next state. It always has
 					 * the setting of the state variable
@@ -426,13 +348,14 @@ static void scan_buf(struct rx_state *rsp, struct packet *pp)
 				rsp->vallim = VAL_LIM_BODY(rsp->bitcnt);
 			}
 		} else {	/* state == BIT_BODY */
-			if ((delta < M_PI && rsp->prev_delta < M_PI) ||
-			    (delta >= M_PI && rsp->prev_delta >= M_PI)) {
+			if (good) {
 				if (++rsp->valcnt >= rsp->vallim) {
 					// bit_val = ..... (delta)
 					// if (rsp->bitcnt >= HDR_LEN)
 					if (rsp->bitcnt >= HDR_LEN) {
 						hgram_one(rsp, rsp->bitcnt);
+						burst_one(rsp, p - (i - start) * 2,
+						    i + 1 - start, rsp->bitcnt);
 						rsp->state = BIT_HUNT;
 						rsp->bitcnt = 0;
 						rsp->valcnt = 0;
@@ -451,15 +374,23 @@ static void scan_buf(struct rx_state *rsp, struct packet *pp)
 				 * for research purposes.
 				 */
 				hgram_one(rsp, rsp->bitcnt);
+				burst_one(rsp, p - (i - start) * 2, i - start,
+				    rsp->bitcnt);
 				rsp->state = BIT_HUNT;
 				rsp->bitcnt = 0;
 				rsp->valcnt = 0;
 			}
 		}
-		rsp->prev_delta = delta;
+		rsp->prev_good = good;
 
 		p += 2;
 	}
+
+	/* The run goes on in the next buffer */
+	if (rsp->state != BIT_HUNT) {
+		upd_sums_add(&rsp->run, p - (num - start) * 2, num - start);
+		rsp->run_len += num - start;
+	}
 }
 
 /*
@@ -487,15 +418,27 @@ static void hgram_one(struct rx_state *rsp, int bitnum)
 	}
 }
 
+/*
+ * The end of a run: the last num pairs of it are at p, and the rest
+ * are in rsp->run. A long enough one is a burst, and counts its power.
+ */
+static void burst_one(struct rx_state *rsp, const int *p, int num,
+    int bitcnt)
+{
+	if (bitcnt < BURST_BITS)
+		return;
+	upd_sums_add(&rsp->run, p, num);
+	rsp->run_len += num;
+	rsp->burst_pow += rsp->run.sq / rsp->run_len;
+	rsp->burst_cnt++;
+}
 
-static void dump_buf(struct rx_state *rsp, struct packet *pp)
+static void dump_buf(struct rx_state *rsp, const int *p, int num)
 {
-	const int *p;
 	int i;
 	int lim;
 
-	p = pp->buf;
-	lim = pp->num < 1000 ? pp->num : 1000;
+	lim = num < 1000 ? num : 1000;
 	for (i = 0; i < lim; i++) {
 		printf("%d %d\n", p[0], p[1]);
 		p += 2;
@@ -505,17 +448,17 @@ static void dump_buf(struct rx_state *rsp, struct packet *pp)
 static void timer_print(
     unsigned long bufcnt,
     unsigned long bufdrop,
-    unsigned long nocore,
     struct rx_state *rsp)
 {
+	const struct upd_lvl *lp = &rsp->lvl;
 	int i;
-	int avg_i, avg_q;
-
-	avg_i = UPD_CUR(&rsp->uavg_i);
-	avg_q = UPD_CUR(&rsp->uavg_q);
 
-	printf("# nocore %lu drop %lu bufs %lu avg I %d Q %d\n",
-	       nocore, bufdrop, bufcnt, avg_i, avg_q);
+	printf("# drop %lu bufs %lu avg I %d Q %d\n",
+	       bufdrop, bufcnt, lp->avg_i, lp->avg_q);
+	/* In dB over 1 LSB of the filter, so full scale is 69 dB */
+	printf("# power %.1f dB peak %d bursts %lu power %.1f dB\n",
+	       lvl_db(lp->power), lp->peak, rsp->burst_cnt,
+	       rsp->burst_cnt ? lvl_db(rsp->burst_pow / rsp->burst_cnt) : 0.0);
 
 	printf(" e1 %lu e2 %lu\n", rsp->hgram_e1, rsp->hgram_e2);
 	/* This multi-line output is easy to dump into gnuplot for analysis. */
@@ -529,6 +472,13 @@ static void timer_print(
 		rsp->hgram[i] = 0;
 	rsp->hgram_e1 = 0;
 	rsp->hgram_e2 = 0;
+	rsp->burst_cnt = 0;
+	rsp->burst_pow = 0;
+}
+
+static double lvl_db(double power)
+{
+	return power > 0 ? 10 * log10(power) : 0.0;
 }
 
 static void parse(struct param *p, char **argv)
@@ -537,6 +487,7 @@ static void parse(struct param *p, char **argv)
 	long lv;
 
 	memset(p, 0, sizeof(struct param));
+	p->source = "airspy";
 	p->lna_gain = 14;
 	p->mix_gain = 12;
 	p->vga_gain = 10;
@@ -554,6 +505,36 @@ static void parse(struct param *p, char **argv)
 				/* if (strcmp(arg, "pre") == 0) */
 				p->mode_capture = -1;
 				break;
+			case 'p':
+				p->packed = 1;
+				break;
+			case 'b':
+				/*
+				 * The slots of the ring are 256 KB each, and
+				 * the ring wants a power of 2 of them.
+				 */
+				if ((arg = *argv++) == NULL || *arg == '-') {
+					fprintf(stderr,
+					    TAG ": missing -b count\n");
+					Usage();
+				}
+				lv = strtol(arg, NULL, 10);
+				if (lv < 2 || lv > NBUFS_MAX ||
+				    (lv & (lv - 1)) != 0) {
+					fprintf(stderr,
+					    TAG ": invalid -b count\n");
+					Usage();
+				}
+				p->nbufs = lv;
+				break;
+			case 'i':
+				if ((arg = *argv++) == NULL) {
+					fprintf(stderr,
+					    TAG ": missing -i source\n");
+					Usage();
+				}
+				p->source = arg;
+				break;
 			case 'g':
 				/*
 				 * These gain values are interpreted by the
@@ -609,110 +590,43 @@ static void parse(struct param *p, char **argv)
 static void Usage(void)
 {
 	fprintf(stderr, "Usage: " TAG " [-c NNNN]"
-            " [-ga lna_gain] [-gm mix_gain] [-gv vga_gain]\n");
+             " [-ga lna_gain] [-gm mix_gain] [-gv vga_gain] [-p] [-b nbufs]"
+	    " [-i source]\n"
+	    "Sources: airspy[:serial] raw16:file|- raw12:file|-"
+	    " synth[:seconds[,snr_db]]\n");
 	exit(1);
 }
 
-static int rx_callback(airspy_transfer_t *xfer)
+/*
+ * Mix n raw samples down by fs/4 and filter them into bp, see fir.h,
+ * and return the number of ints. The source keeps the buffers in
+ * multiples of 4 samples, so the phase of the mixing goes on across them.
+ */
+static int convert(const unsigned char *sp, int n, int *bp)
 {
-	int i;
-	unsigned char *sp;
-	struct packet *pp;
-	int *bp;
-
 	if (bias_timer == 0) {
-		if (xfer->sample_count >= BVLEN) {
-			sp = xfer->samples;
-			dc_bias = dc_bias_update(sp);
-		}
+		if (n >= BVLEN)
+			dc_bias = dc_bias_update(sp, fir.packed);
 	}
 	bias_timer = (bias_timer + 1) % 10;
 
-	/*
-	 * Premature optimization is the root of all evil. -- D. Knuth
-	 */
-	bp = malloc(xfer->sample_count * sizeof(int));
-	if (bp == NULL) {
-		pthread_mutex_lock(&rx_mutex);
-		c_stat.c_nocore++;
-		pthread_mutex_unlock(&rx_mutex);
-		return 0;
-	}
-
-	sp = xfer->samples;
-	for (i = 0; i < xfer->sample_count; i += 4) {
-		unsigned int sample;
-		int value;
-
-		// sample = sp[1]<<8 | sp[0];
-		// value = (int) sample - (int) dc_bias;
-		// p = avg_update(&rs.smoo, abs(value));
-
-		/*
-		 * This also decimates by two, but whatever.
-		 */
-
-		sample = sp[1]<<8 | sp[0];
-		value = (int) sample - (int) dc_bias;
-		bp[i+0] = value;	// I(0) = cos(0 *pi/2) * x(0)
-
-		sample = sp[3]<<8 | sp[2];
-		value = (int) sample - (int) dc_bias;
-		bp[i+1] = value * -1;	// Q(0) = -j*sin(1 * pi/2) * x(1)
-
-		sample = sp[5]<<8 | sp[4];
-		value = (int) sample - (int) dc_bias;
-		bp[i+2] = value * -1;	// I(1) = cos(2 * pi/2) * x(2)
-
-		sample = sp[7]<<8 | sp[6];
-		value = (int) sample - (int) dc_bias;
-		bp[i+3] = value;	// Q(1) = -j*sin(3 * pi/2) * x(3)
-
-		sp += 8;
-	}
-
-	pp = malloc(sizeof(struct packet));
-	if (pp == NULL) {
-		free(bp);
-		pthread_mutex_lock(&rx_mutex);
-		c_stat.c_nocore++;
-		pthread_mutex_unlock(&rx_mutex);
-		return 0;
-	}
-	memset(pp, 0, sizeof(struct packet));
-	pp->num = xfer->sample_count / 2;
-	pp->buf = bp;
-
-	pthread_mutex_lock(&rx_mutex);
-	if (pcnt >= PMAX) {
-		c_stat.c_bufdrop++;
-		pthread_mutex_unlock(&rx_mutex);
-		free(pp->buf);
-		free(pp);
-		return 0;
-	}
-
-	if (pcnt == 0) {
-		phead = pp;
-		ptail = pp;
-	} else {
-		ptail->next = pp;
-		ptail = pp;
-	}
-	pcnt++;
-	pthread_cond_broadcast(&rx_cond);
-	pthread_mutex_unlock(&rx_mutex);
-
-	return 0;
+	return fir_run(&fir, sp, n, dc_bias, bp);
 }
 
 // Method Zero: direct calculation of the average (the fastest, strangely)
-static unsigned int dc_bias_update(unsigned char *sp)
+static unsigned int dc_bias_update(const unsigned char *sp, int packed)
 {
+	unsigned short s[BVLEN];
 	int i;
 	unsigned int sum;
 
 	sum = 0;
+	if (packed) {
+		fir_unpack12(s, sp, BVLEN);
+		for (i = 0; i < BVLEN; i++)
+			sum += s[i];
+		return sum / BVLEN;
+	}
 	for (i = 0; i < BVLEN; i++) {
 		sum += ((unsigned int) sp[1])<<8 | sp[0];
 		sp += 2;
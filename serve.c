@@ -0,0 +1,410 @@
+/*
+ * The server: an epoll loop that fans the frames out to the clients
+ */
+
+#define _GNU_SOURCE		/* accept4 */
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "serve.h"
+
+/*
+ * The queue of a client holds about a second of a busy Uplink station.
+ */
+#define SERVE_QLEN  (256*1024)
+
+#define SERVE_NEV   16
+
+static void *serve_thread(void *arg);
+static void serve_accept(struct server *s, int lfd, int kind);
+static void serve_flush(struct server *s, struct serve_client *cp);
+static void serve_reap(struct server *s);
+static void serve_kick(struct server *s);
+
+int serve_init(struct server *s)
+{
+	memset(s, 0, sizeof(struct server));
+	s->epfd = epoll_create1(EPOLL_CLOEXEC);
+	if (s->epfd == -1)
+		goto err_ep;
+	s->evfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (s->evfd == -1)
+		goto err_ev;
+	pthread_mutex_init(&s->mutex, NULL);
+	return 0;
+
+err_ev:
+	close(s->epfd);
+err_ep:
+	return -1;
+}
+
+/*
+ * Listen at addr, which is a TCP port, or a path of a Unix socket if
+ * it has a slash in it.
+ */
+int serve_listen(struct server *s, const char *addr, int kind)
+{
+	struct sockaddr_in sin;
+	struct sockaddr_un sun;
+	char *end;
+	long port;
+	const int type = SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK;
+	int on = 1;
+	int fd;
+
+	if (s->nlis >= SERVE_MAXL)
+		return -1;
+
+	if (strchr(addr, '/') != NULL) {
+		if (strlen(addr) >= sizeof(sun.sun_path))
+			return -1;
+		fd = socket(AF_UNIX, type, 0);
+		if (fd == -1)
+			return -1;
+		memset(&sun, 0, sizeof(sun));
+		sun.sun_family = AF_UNIX;
+		strcpy(sun.sun_path, addr);
+		/* A stale socket from the last run would fail the bind */
+		unlink(addr);
+		if (bind(fd, (struct sockaddr *) &sun, sizeof(sun)) != 0)
+			goto err;
+		if ((s->lis[s->nlis].path = strdup(addr)) == NULL) {
+			unlink(addr);
+			goto err;
+		}
+	} else {
+		port = strtol(addr, &end, 10);
+		if (*end != 0 || port <= 0 || port > 65535)
+			return -1;
+		fd = socket(AF_INET, type, 0);
+		if (fd == -1)
+			return -1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		memset(&sin, 0, sizeof(sin));
+		sin.sin_family = AF_INET;
+		sin.sin_port = htons(port);
+		sin.sin_addr.s_addr = htonl(INADDR_ANY);
+		if (bind(fd, (struct sockaddr *) &sin, sizeof(sin)) != 0)
+			goto err;
+		s->lis[s->nlis].path = NULL;
+	}
+	if (listen(fd, 8) != 0)
+		goto err_listen;
+
+	s->lis[s->nlis].fd = fd;
+	s->lis[s->nlis].kind = kind;
+	s->nlis++;
+	return 0;
+
+err_listen:
+	if (s->lis[s->nlis].path != NULL) {
+		unlink(s->lis[s->nlis].path);
+		free(s->lis[s->nlis].path);
+		s->lis[s->nlis].path = NULL;
+	}
+err:
+	close(fd);
+	return -1;
+}
+
+/*
+ * The data of an epoll event is the fd for the clients, and for the
+ * listeners and the eventfd it's negative, so we can tell them apart.
+ */
+#define EV_EVFD   (-1)
+#define EV_LIS(i) (-2 - (i))
+
+int serve_start(struct server *s)
+{
+	struct epoll_event ev;
+	int i;
+
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.u64 = (uint64_t)(int64_t) EV_EVFD;
+	if (epoll_ctl(s->epfd, EPOLL_CTL_ADD, s->evfd, &ev) != 0)
+		return -1;
+	for (i = 0; i < s->nlis; i++) {
+		ev.events = EPOLLIN;
+		ev.data.u64 = (uint64_t)(int64_t) EV_LIS(i);
+		if (epoll_ctl(s->epfd, EPOLL_CTL_ADD, s->lis[i].fd, &ev))
+			return -1;
+	}
+	if (pthread_create(&s->thread, NULL, serve_thread, s) != 0)
+		return -1;
+	s->running = 1;
+	return 0;
+}
+
+/*
+ * Stop the thread if it was started, and close everything.
+ * The clients get what is queued for them, if they take it right away.
+ */
+void serve_fini(struct server *s)
+{
+	struct serve_client *cp;
+	int i;
+
+	if (s->running) {
+		pthread_mutex_lock(&s->mutex);
+		s->closed = 1;
+		pthread_mutex_unlock(&s->mutex);
+		serve_kick(s);
+		pthread_join(s->thread, NULL);
+	}
+
+	while ((cp = s->clients) != NULL) {
+		s->clients = cp->next;
+		close(cp->fd);
+		free(cp->buf);
+		free(cp);
+	}
+	for (i = 0; i < s->nlis; i++) {
+		close(s->lis[i].fd);
+		if (s->lis[i].path != NULL) {
+			unlink(s->lis[i].path);
+			free(s->lis[i].path);
+		}
+	}
+	pthread_mutex_destroy(&s->mutex);
+	close(s->evfd);
+	close(s->epfd);
+}
+
+/*
+ * Is anyone listening for this kind? Saves formatting for nobody.
+ * This is racy, but a client that connects just now misses one frame.
+ */
+int serve_wants(struct server *s, int kind)
+{
+	return __atomic_load_n(&s->nclients[kind], __ATOMIC_RELAXED) != 0;
+}
+
+/*
+ * Queue a message for every client of the kind. A client that has no
+ * room for it is cut off, it cannot keep up anyway.
+ */
+void serve_publish(struct server *s, int kind, const void *p, size_t len)
+{
+	struct serve_client *cp;
+	size_t tail, n;
+	int kick = 0;
+
+	pthread_mutex_lock(&s->mutex);
+	for (cp = s->clients; cp != NULL; cp = cp->next) {
+		if (cp->kind != kind || cp->dead)
+			continue;
+		if (cp->fill + len > SERVE_QLEN) {
+			cp->dead = 1;
+			s->slow++;
+			kick = 1;
+			continue;
+		}
+		tail = (cp->head + cp->fill) % SERVE_QLEN;
+		n = SERVE_QLEN - tail;
+		if (n > len)
+			n = len;
+		memcpy(cp->buf + tail, p, n);
+		memcpy(cp->buf, (const char *) p + n, len - n);
+		/* Only an empty queue needs a kick, the rest have EPOLLOUT */
+		if (cp->fill == 0)
+			kick = 1;
+		cp->fill += len;
+	}
+	pthread_mutex_unlock(&s->mutex);
+	if (kick)
+		serve_kick(s);
+}
+
+unsigned long serve_slow(struct server *s)
+{
+	unsigned long n;
+
+	pthread_mutex_lock(&s->mutex);
+	n = s->slow;
+	pthread_mutex_unlock(&s->mutex);
+	return n;
+}
+
+static void *serve_thread(void *arg)
+{
+	struct server *s = arg;
+	struct epoll_event evv[SERVE_NEV];
+	struct serve_client *cp;
+	char junk[512];
+	uint64_t cnt;
+	ssize_t rc;
+	int64_t d;
+	int n, i, i_l;
+
+	for (;;) {
+		n = epoll_wait(s->epfd, evv, SERVE_NEV, -1);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		pthread_mutex_lock(&s->mutex);
+		if (s->closed) {
+			/* One last try, for those who keep up, see serve_fini() */
+			for (cp = s->clients; cp; cp = cp->next)
+				serve_flush(s, cp);
+			pthread_mutex_unlock(&s->mutex);
+			break;
+		}
+		for (i = 0; i < n; i++) {
+			d = (int64_t) evv[i].data.u64;
+			if (d == EV_EVFD) {
+				if (read(s->evfd, &cnt, sizeof(cnt)) < 0)
+					;
+				/* Something was queued, try everyone */
+				for (cp = s->clients; cp; cp = cp->next)
+					serve_flush(s, cp);
+			} else if (d < 0) {
+				i_l = EV_LIS(0) - d;
+				serve_accept(s, s->lis[i_l].fd,
+				    s->lis[i_l].kind);
+			} else {
+				for (cp = s->clients; cp; cp = cp->next) {
+					if (cp->fd == d)
+						break;
+				}
+				if (cp == NULL)
+					continue;
+				if (evv[i].events & (EPOLLHUP | EPOLLERR)) {
+					cp->dead = 1;
+					continue;
+				}
+				/* Clients have nothing to say to us */
+				if (evv[i].events & EPOLLIN) {
+					rc = read(cp->fd, junk,
+					    sizeof(junk));
+					if (rc == 0 ||
+					    (rc < 0 && errno != EAGAIN))
+						cp->dead = 1;
+				}
+				if (evv[i].events & EPOLLOUT)
+					serve_flush(s, cp);
+			}
+		}
+		serve_reap(s);
+		pthread_mutex_unlock(&s->mutex);
+	}
+	return NULL;
+}
+
+static void serve_accept(struct server *s, int lfd, int kind)
+{
+	struct serve_client *cp;
+	struct epoll_event ev;
+	int fd;
+
+	fd = accept4(lfd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+	if (fd == -1)
+		return;
+	if ((cp = malloc(sizeof(struct serve_client))) == NULL)
+		goto err_alloc;
+	memset(cp, 0, sizeof(struct serve_client));
+	if ((cp->buf = malloc(SERVE_QLEN)) == NULL)
+		goto err_buf;
+	cp->fd = fd;
+	cp->kind = kind;
+
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.u64 = fd;
+	if (epoll_ctl(s->epfd, EPOLL_CTL_ADD, fd, &ev) != 0)
+		goto err_ctl;
+
+	cp->next = s->clients;
+	s->clients = cp;
+	__atomic_store_n(&s->nclients[kind], s->nclients[kind] + 1,
+	    __ATOMIC_RELAXED);
+	return;
+
+err_ctl:
+	free(cp->buf);
+err_buf:
+	free(cp);
+err_alloc:
+	close(fd);
+}
+
+/*
+ * Write what we can without blocking, and ask for EPOLLOUT if there's
+ * more, or stop asking if there's not.
+ */
+static void serve_flush(struct server *s, struct serve_client *cp)
+{
+	struct epoll_event ev;
+	ssize_t rc;
+	size_t n;
+	int want;
+
+	while (cp->fill != 0 && !cp->dead) {
+		n = SERVE_QLEN - cp->head;
+		if (n > cp->fill)
+			n = cp->fill;
+		rc = send(cp->fd, cp->buf + cp->head, n, MSG_NOSIGNAL);
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				cp->dead = 1;
+			break;
+		}
+		cp->head = (cp->head + rc) % SERVE_QLEN;
+		cp->fill -= rc;
+	}
+	if (cp->dead)
+		return;
+
+	want = cp->fill != 0;
+	if (want != cp->pollout) {
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN | (want ? EPOLLOUT : 0);
+		ev.data.u64 = cp->fd;
+		epoll_ctl(s->epfd, EPOLL_CTL_MOD, cp->fd, &ev);
+		cp->pollout = want;
+	}
+}
+
+static void serve_reap(struct server *s)
+{
+	struct serve_client **pp, *cp;
+
+	pp = &s->clients;
+	while ((cp = *pp) != NULL) {
+		if (!cp->dead) {
+			pp = &cp->next;
+			continue;
+		}
+		*pp = cp->next;
+		__atomic_store_n(&s->nclients[cp->kind],
+		    s->nclients[cp->kind] - 1, __ATOMIC_RELAXED);
+		/* Closing the fd takes it out of the epoll set, too */
+		close(cp->fd);
+		free(cp->buf);
+		free(cp);
+	}
+}
+
+static void serve_kick(struct server *s)
+{
+	uint64_t one = 1;
+
+	if (write(s->evfd, &one, sizeof(one)) < 0)
+		;
+}
@@ -0,0 +1,57 @@
+/*
+ * The server: fan-out of decoded frames to the clients of our sockets
+ *
+ * Every listening socket, TCP or Unix, has a kind, and a message that
+ * is published with a kind goes to every client that connected to a
+ * listener of that kind. So, the binary protocol and the text lines
+ * are the same engine, only the decoder formats the frame twice.
+ *
+ * A thread of the server runs an epoll loop, which accepts the clients
+ * and writes to them. The decoder only appends to the queue of every
+ * client. When a queue is full, the client is too slow, and it's
+ * disconnected, so that the decoder never waits for anyone.
+ */
+#include <pthread.h>
+#include <stddef.h>
+
+#define SERVE_BIN   0	/* the binary frames, see ruat.c */
+#define SERVE_TEXT  1	/* the lines, as dump978 prints them */
+#define SERVE_NKIND 2
+
+#define SERVE_MAXL  8	/* listeners */
+
+struct serve_client {
+	struct serve_client *next;
+	int fd;
+	int kind;
+	int dead;		/* too slow, or hung up */
+	int pollout;		/* EPOLLOUT is on */
+	char *buf;		/* queue, a ring of SERVE_QLEN */
+	size_t head, fill;
+};
+
+struct server {
+	int epfd;
+	int evfd;		/* kicks the loop when there's news */
+	pthread_t thread;
+	pthread_mutex_t mutex;	/* the clients and their queues */
+	struct {
+		int fd;
+		int kind;
+		char *path;	/* Unix socket, to unlink; NULL for TCP */
+	} lis[SERVE_MAXL];
+	int nlis;
+	struct serve_client *clients;
+	int nclients[SERVE_NKIND];
+	unsigned long slow;	/* clients dropped for being too slow */
+	int running;		/* the thread is started */
+	int closed;
+};
+
+int serve_init(struct server *s);
+int serve_listen(struct server *s, const char *addr, int kind);
+int serve_start(struct server *s);
+void serve_fini(struct server *s);
+int serve_wants(struct server *s, int kind);
+void serve_publish(struct server *s, int kind, const void *p, size_t len);
+unsigned long serve_slow(struct server *s);
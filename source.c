@@ -0,0 +1,101 @@
+/*
+ * The source: the part that is the same for all backends
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "source.h"
+
+/*
+ * The spec is "name" or "name:arg", and the arg is up to the backend.
+ */
+int source_open(struct source *sp, const struct source_ops *const *tab,
+    const char *spec, const struct source_conf *conf)
+{
+	const char *colon;
+	size_t n;
+
+	memset(sp, 0, sizeof(struct source));
+	sp->conf = conf;
+	sp->format = conf->format;
+
+	colon = strchr(spec, ':');
+	n = (colon != NULL) ? colon - spec : strlen(spec);
+	for (; *tab != NULL; tab++) {
+		if (strlen((*tab)->name) == n &&
+		    memcmp((*tab)->name, spec, n) == 0)
+			break;
+	}
+	if (*tab == NULL)
+		return -1;
+	sp->ops = *tab;
+	return sp->ops->open(sp, (colon != NULL) ? colon + 1 : "");
+}
+
+int source_start(struct source *sp)
+{
+	return sp->ops->start(sp);
+}
+
+/*
+ * Wait up to timeout_ms for a buffer, -1 to wait forever. Returns 1 and
+ * the buffer, 0 on a timeout, or -1 when the source has ended.
+ */
+int source_get(struct source *sp, const void **pp, size_t *lenp,
+    int timeout_ms)
+{
+	void *p;
+	int rc;
+
+	if (!sp->use_ring) {
+		if ((rc = sp->ops->get(sp, pp, lenp)) <= 0)
+			return rc;
+	} else {
+		while ((p = ring_peek(&sp->ring, lenp)) == NULL) {
+			rc = ring_wait(&sp->ring, timeout_ms);
+			if (rc < 0)
+				return -1;
+			if (rc == 0) {
+				if (sp->ops->poll != NULL &&
+				    sp->ops->poll(sp) < 0)
+					return -1;
+				return 0;
+			}
+		}
+		*pp = p;
+	}
+	sp->bufs++;
+	sp->samples += (sp->format == SOURCE_RAW12) ? *lenp / 3 * 2 : *lenp / 2;
+	return 1;
+}
+
+/*
+ * Done with the buffer of the last source_get().
+ */
+void source_put(struct source *sp)
+{
+	if (sp->use_ring)
+		ring_release(&sp->ring);
+}
+
+/*
+ * Only the thread that gets the buffers may call this, like ring_drops().
+ */
+void source_stats(const struct source *sp, struct source_stats *st)
+{
+	st->bufs = sp->bufs;
+	st->samples = sp->samples;
+	st->drops = sp->use_ring ? ring_drops(&sp->ring) : 0;
+}
+
+void source_stop(struct source *sp)
+{
+	if (sp->ops->stop != NULL)
+		sp->ops->stop(sp);
+}
+
+void source_close(struct source *sp)
+{
+	sp->ops->close(sp);
+}
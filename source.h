@@ -0,0 +1,92 @@
+/*
+ * The source: where the samples come from
+ *
+ * A source is opened by a spec, such as "rtlsdr:1" or "cu8:capture.cu8",
+ * which names a backend and gives it an argument. Every program passes
+ * the table of the backends it was linked with, because a backend of a
+ * device needs its library.
+ *
+ * The decoder gets buffers from the source with source_get(), uses them
+ * in place, and gives them back with source_put(). The backends of the
+ * devices copy the USB transfers into a ring (see ring.h), because the
+ * libraries want their buffers back when the callback returns. The files
+ * and the generator hand out pointers to their memory, and never drop.
+ *
+ * The sources are independent of each other, so a program may have
+ * several, but the buffers of one source go to one thread only.
+ */
+#include <pthread.h>
+#include <stddef.h>
+
+#include "ring.h"
+
+#define SOURCE_CU8    0	/* I/Q pairs of unsigned bytes, as rtl_sdr */
+#define SOURCE_RAW16  1	/* real 12-bit samples of Airspy, in 16 bits */
+#define SOURCE_RAW12  2	/* the same, packed 8 in 12 bytes */
+
+/*
+ * What the decoder wants, and the settings of the devices. A backend of
+ * a file cannot help its format, so the decoder checks sp->format.
+ * Airspy packs its samples if asked for SOURCE_RAW12, which takes a
+ * quarter less of USB.
+ */
+struct source_conf {
+	int format;		/* for the generator and Airspy */
+	unsigned long rate;	/* samples per second */
+	unsigned long freq;	/* Hz, the center */
+	int gain;		/* rtlsdr, in dB; ~0 for auto */
+	int ppm;		/* rtlsdr */
+	int lna_gain, mix_gain, vga_gain;	/* airspy */
+	unsigned int nbufs;	/* airspy, slots of the ring; 0 for default */
+};
+
+struct source_stats {
+	unsigned long bufs;
+	unsigned long samples;
+	unsigned long drops;	/* buffers lost for the lack of room */
+};
+
+struct source;
+
+struct source_ops {
+	const char *name;
+	int (*open)(struct source *sp, const char *arg);
+	int (*start)(struct source *sp);
+	/*
+	 * The backends without a ring hand out their buffers here.
+	 * Returns 1 with a buffer, or -1 at the end.
+	 */
+	int (*get)(struct source *sp, const void **pp, size_t *lenp);
+	/* The ones with a ring say here if the device is still there */
+	int (*poll)(struct source *sp);
+	void (*stop)(struct source *sp);
+	void (*close)(struct source *sp);
+};
+
+struct source {
+	const struct source_ops *ops;
+	const struct source_conf *conf;
+	int format;
+	int live;		/* a device, which does not wait for us */
+	int use_ring;		/* the backend fills ring */
+	struct ring ring;
+	void *priv;		/* the backend's */
+	unsigned long bufs, samples;
+};
+
+int source_open(struct source *sp, const struct source_ops *const *tab,
+    const char *spec, const struct source_conf *conf);
+int source_start(struct source *sp);
+int source_get(struct source *sp, const void **pp, size_t *lenp,
+    int timeout_ms);
+void source_put(struct source *sp);
+void source_stats(const struct source *sp, struct source_stats *st);
+void source_stop(struct source *sp);
+void source_close(struct source *sp);
+
+extern const struct source_ops source_rtlsdr;	/* src_rtlsdr.c */
+extern const struct source_ops source_airspy;	/* src_airspy.c */
+extern const struct source_ops source_cu8;	/* src_file.c */
+extern const struct source_ops source_raw16;	/* src_file.c */
+extern const struct source_ops source_raw12;	/* src_file.c */
+extern const struct source_ops source_synth;	/* src_synth.c */
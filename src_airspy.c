@@ -0,0 +1,286 @@
+/*
+ * The source: Airspy, by libairspy, in the raw mode
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <airspy.h>
+
+#include "source.h"
+
+#define TAG "airspy"
+
+/*
+ * The slots of the ring are the raw transfers, as they come from USB.
+ * Transfers longer than SLOT_SAMPLES are cut short, but libairspy never
+ * makes them so. Packed, they take 3/4 of the slot. The slots are all
+ * allocated at the open, so the callback never calls malloc(), and
+ * their number is up to the user: PMAX is about 0.2 s of samples.
+ */
+#define PMAX  16
+#define SLOT_SAMPLES  (128*1024)
+
+struct src_airspy {
+	struct airspy_device *device;
+	int running;
+};
+
+static int airspy_src_open(struct source *sp, const char *arg);
+static int airspy_src_start(struct source *sp);
+static int airspy_src_poll(struct source *sp);
+static void airspy_src_stop(struct source *sp);
+static void airspy_src_close(struct source *sp);
+static int rx_callback(airspy_transfer_t *xfer);
+
+const struct source_ops source_airspy = {
+	.name = "airspy",
+	.open = airspy_src_open,
+	.start = airspy_src_start,
+	.poll = airspy_src_poll,
+	.stop = airspy_src_stop,
+	.close = airspy_src_close,
+};
+
+/*
+ * The arg is the serial number in hex, or empty for any device.
+ */
+static int airspy_src_open(struct source *sp, const char *arg)
+{
+	const struct source_conf *conf = sp->conf;
+	struct src_airspy *ap;
+	unsigned long long serial;
+	unsigned int nbufs;
+	char *end;
+	int rc;
+
+	serial = strtoull(arg, &end, 16);
+	if (*end != 0) {
+		fprintf(stderr, TAG ": Invalid serial `%s'\n", arg);
+		return -1;
+	}
+
+	if ((ap = malloc(sizeof(struct src_airspy))) == NULL)
+		goto err_alloc;
+	memset(ap, 0, sizeof(struct src_airspy));
+	nbufs = conf->nbufs ? conf->nbufs : PMAX;
+	if (ring_init(&sp->ring, nbufs, SLOT_SAMPLES * sizeof(uint16_t)) != 0) {
+		fprintf(stderr, TAG ": ring_init(%u) failed\n", nbufs);
+		goto err_ring;
+	}
+
+	rc = airspy_init();
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_init() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_init;
+	}
+
+	// open any device, or by the serial, result by reference
+	if (*arg == 0)
+		rc = airspy_open(&ap->device);
+	else
+		rc = airspy_open_sn(&ap->device, serial);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_open() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_open;
+	}
+
+	rc = airspy_set_sample_type(ap->device, AIRSPY_SAMPLE_RAW);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr,
+		    TAG ": airspy_set_sample_type() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_set;
+	}
+
+	// set by index, rate 20m
+	rc = airspy_set_samplerate(ap->device, 0);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr,
+		    TAG ": airspy_set_samplerate() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_set;
+	}
+
+	// Packing: 1 - 12 bits, 0 - 16 bits
+	rc = airspy_set_packing(ap->device, conf->format == SOURCE_RAW12);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_set_packing() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_set;
+	}
+
+	// Not sure why this is not optional
+	rc = airspy_set_rf_bias(ap->device, 0);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_set_rf_bias() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		goto err_set;
+	}
+
+	// VGA is "Variable Gain Amplifier": the exit amplifier after mixer
+	// and filter in R820T.
+	//
+	// Default in airspy_rx is 5; rtl-sdr sets 11 (26.5 dB) FWIW.
+	// We experimented a little, and leave 12 for now.
+	//
+	// Register address: 0x0c
+	// 0x80  unused, set 1
+	// 0x40  VGA power:     0 off, 1 on
+	// 0x20  unused, set 1
+	// 0x10  VGA mode:      0 gain control by VAGC pin,
+	//                      1 gain control by code in this register
+	// 0x0f  VGA gain code: 0x0 -12 dB, 0xf +40.5 dB, with -3.5dB/step
+	//
+	// The software only transfers the value 0..15. Firmware sets the rest.
+	rc = airspy_set_vga_gain(ap->device, conf->vga_gain);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr,
+		    TAG ": airspy_set_vga_gain() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+	}
+
+	// Mixer has its own gain. Not sure how that works, perhaps relative
+	// to the oscillator signal.
+	//
+	// Default in airspy_rx is 5; rtl-sdr does 0x10 to enable auto.
+	//
+	// Register address: 0x07
+	// 0x80  unused, set 0
+	// 0x40  Mixer power:   0 off, 1 on
+	// 0x20  Mixer current: 0 max current, 1 normal current
+	// 0x10  Mixer mode:    0 manual mode, 1 auto mode
+	// 0x0f  manual gain level
+	//
+	// The software only transfers the value 0..15. Firmware sets the rest.
+	rc = airspy_set_mixer_gain(ap->device, conf->mix_gain);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr,
+		    TAG ": airspy_set_mixer_gain() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+	}
+
+	// The LNA is the pre-amp at the receive frequency before mixing.
+	//
+	// The default in airspy_rx is 1.
+	//
+	// Register address: 0x05
+	// 0x80  Loop through:  0 on, 1 off  -- weird, backwards
+	// 0x40  unused, set 0
+	// 0x20  LNA1 Power:    0 on, 1 off
+	// 0x10  Auto gain:     0 auto, 1 manual
+	// 0x0F  manual gain level, 0 is min gain, 15 is max gain
+	//
+	// The software only transfers the value 0..14. Firmware sets the rest.
+	rc = airspy_set_lna_gain(ap->device, conf->lna_gain);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr,
+		    TAG ": airspy_set_lna_gain() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+	}
+
+	sp->format = (conf->format == SOURCE_RAW12) ?
+	    SOURCE_RAW12 : SOURCE_RAW16;
+	sp->live = 1;
+	sp->use_ring = 1;
+	sp->priv = ap;
+	return 0;
+
+err_set:
+	airspy_close(ap->device);
+err_open:
+	airspy_exit();
+err_init:
+	ring_fini(&sp->ring);
+err_ring:
+	free(ap);
+err_alloc:
+	return -1;
+}
+
+static int airspy_src_start(struct source *sp)
+{
+	const struct source_conf *conf = sp->conf;
+	struct src_airspy *ap = sp->priv;
+	int rc;
+
+	rc = airspy_start_rx(ap->device, rx_callback, sp);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_start_rx() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		return -1;
+	}
+	ap->running = 1;
+
+	// No idea why the frequency is set after the start of the receiving
+	rc = airspy_set_freq(ap->device, conf->freq);
+	if (rc != AIRSPY_SUCCESS) {
+		fprintf(stderr, TAG ": airspy_set_freq() failed: %s (%d)\n",
+		    airspy_error_name(rc), rc);
+		airspy_src_stop(sp);
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * libairspy has no callback for the end, so the decoder asks.
+ */
+static int airspy_src_poll(struct source *sp)
+{
+	struct src_airspy *ap = sp->priv;
+
+	return airspy_is_streaming(ap->device) ? 0 : -1;
+}
+
+static void airspy_src_stop(struct source *sp)
+{
+	struct src_airspy *ap = sp->priv;
+
+	if (ap->running) {
+		airspy_stop_rx(ap->device);
+		ap->running = 0;
+	}
+}
+
+static void airspy_src_close(struct source *sp)
+{
+	struct src_airspy *ap = sp->priv;
+
+	airspy_src_stop(sp);
+	airspy_close(ap->device);
+	airspy_exit();
+	ring_fini(&sp->ring);
+	free(ap);
+}
+
+/*
+ * This runs in the thread of libairspy, the only producer of the ring.
+ * When the ring is full, the transfer is dropped and the ring counts it.
+ * In the raw mode, libairspy passes the packed samples as they come,
+ * and counts them as unpacked, so 8 of them are in 12 bytes.
+ */
+static int rx_callback(airspy_transfer_t *xfer)
+{
+	struct source *sp = xfer->ctx;
+	size_t len;
+	void *bp;
+	int n;
+
+	if ((bp = ring_claim(&sp->ring)) == NULL)
+		return 0;
+	n = xfer->sample_count;
+	if (n > SLOT_SAMPLES)
+		n = SLOT_SAMPLES;
+	if (sp->format == SOURCE_RAW12)
+		len = n / 8 * 12;
+	else
+		len = n * sizeof(uint16_t);
+	memcpy(bp, xfer->samples, len);
+	ring_commit(&sp->ring, len);
+	return 0;
+}
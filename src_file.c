@@ -0,0 +1,192 @@
+/*
+ * The source: captures in files, or coming down a pipe
+ *
+ * A regular file is mapped, and the buffers are slices of the map.
+ * Anything else, such as stdin, is read into a buffer of our own.
+ * Either way, the decoder goes as fast as it can, and nothing is lost.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "source.h"
+
+#define FILE_BUF  (256*1024)
+
+struct src_file {
+	int fd;
+	unsigned char *map;	/* MAP_FAILED if we read */
+	size_t map_size;
+	size_t size, off;	/* whole samples in the map */
+	unsigned char *buf;
+	size_t fill, last;
+	/*
+	 * Every buffer is a multiple of this, so a sample is never split,
+	 * and the mixing of Airspy samples by fs/4 starts in phase.
+	 */
+	size_t align;
+};
+
+static int file_open(struct source *sp, const char *arg, int format,
+    size_t align);
+static int cu8_open(struct source *sp, const char *arg);
+static int raw16_open(struct source *sp, const char *arg);
+static int raw12_open(struct source *sp, const char *arg);
+static int file_start(struct source *sp);
+static int file_get(struct source *sp, const void **pp, size_t *lenp);
+static void file_close(struct source *sp);
+
+const struct source_ops source_cu8 = {
+	.name = "cu8",
+	.open = cu8_open,
+	.start = file_start,
+	.get = file_get,
+	.close = file_close,
+};
+
+const struct source_ops source_raw16 = {
+	.name = "raw16",
+	.open = raw16_open,
+	.start = file_start,
+	.get = file_get,
+	.close = file_close,
+};
+
+const struct source_ops source_raw12 = {
+	.name = "raw12",
+	.open = raw12_open,
+	.start = file_start,
+	.get = file_get,
+	.close = file_close,
+};
+
+static int cu8_open(struct source *sp, const char *arg)
+{
+	return file_open(sp, arg, SOURCE_CU8, 2);
+}
+
+static int raw16_open(struct source *sp, const char *arg)
+{
+	return file_open(sp, arg, SOURCE_RAW16, 8);
+}
+
+static int raw12_open(struct source *sp, const char *arg)
+{
+	return file_open(sp, arg, SOURCE_RAW12, 12);
+}
+
+/*
+ * The arg is the name of the file, or "-" for stdin.
+ */
+static int file_open(struct source *sp, const char *arg, int format,
+    size_t align)
+{
+	struct src_file *fp;
+	struct stat st;
+
+	if ((fp = malloc(sizeof(struct src_file))) == NULL)
+		goto err_alloc;
+	memset(fp, 0, sizeof(struct src_file));
+	fp->align = align;
+	fp->map = MAP_FAILED;
+
+	if (strcmp(arg, "-") == 0) {
+		fp->fd = 0;
+	} else if ((fp->fd = open(arg, O_RDONLY)) == -1) {
+		fprintf(stderr, "%s: %s\n", arg, strerror(errno));
+		goto err_open;
+	}
+	if (fstat(fp->fd, &st) == 0 && S_ISREG(st.st_mode) &&
+	    st.st_size != 0) {
+		fp->map_size = st.st_size;
+		fp->size = st.st_size - st.st_size % align;
+		fp->map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+		    fp->fd, 0);
+	}
+	if (fp->map != MAP_FAILED) {
+		madvise(fp->map, st.st_size, MADV_SEQUENTIAL);
+	} else {
+		if ((fp->buf = malloc(FILE_BUF)) == NULL)
+			goto err_buf;
+	}
+
+	sp->format = format;
+	sp->priv = fp;
+	return 0;
+
+err_buf:
+	if (fp->fd != 0)
+		close(fp->fd);
+err_open:
+	free(fp);
+err_alloc:
+	return -1;
+}
+
+static int file_start(struct source *sp)
+{
+	return 0;
+}
+
+static int file_get(struct source *sp, const void **pp, size_t *lenp)
+{
+	struct src_file *fp = sp->priv;
+	ssize_t rc;
+	size_t n;
+
+	if (fp->map != MAP_FAILED) {
+		if (fp->off >= fp->size)
+			return -1;
+		n = fp->size - fp->off;
+		if (n > FILE_BUF - FILE_BUF % fp->align)
+			n = FILE_BUF - FILE_BUF % fp->align;
+		*pp = fp->map + fp->off;
+		*lenp = n;
+		fp->off += n;
+		return 1;
+	}
+
+	/* What was not a whole sample last time goes first */
+	if (fp->last != 0) {
+		memmove(fp->buf, fp->buf + fp->last, fp->fill - fp->last);
+		fp->fill -= fp->last;
+		fp->last = 0;
+	}
+	for (;;) {
+		rc = read(fp->fd, fp->buf + fp->fill, FILE_BUF - fp->fill);
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			fprintf(stderr, "read error: %s\n", strerror(errno));
+			return -1;
+		}
+		if (rc == 0)
+			return -1;
+		fp->fill += rc;
+		n = fp->fill - fp->fill % fp->align;
+		if (n != 0)
+			break;
+	}
+	*pp = fp->buf;
+	*lenp = n;
+	fp->last = n;
+	return 1;
+}
+
+static void file_close(struct source *sp)
+{
+	struct src_file *fp = sp->priv;
+
+	if (fp->map != MAP_FAILED)
+		munmap(fp->map, fp->map_size);
+	free(fp->buf);
+	if (fp->fd != 0)
+		close(fp->fd);
+	free(fp);
+}
@@ -0,0 +1,270 @@
+/*
+ * The source: RTL-SDR dongles, by librtlsdr
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtl-sdr.h>
+
+#include "source.h"
+
+#define TAG "rtlsdr"
+
+#define BUF_MAX  256
+/*
+ * The built-in default is not visible to rtlsdr clients. So, hardcode.
+ */
+#define DEFAULT_BUF_LENGTH	(16 * 32 * 512)
+
+/*
+ * The ring takes the USB buffers as they are, so its slots are only
+ * as large as those, and we can afford as many as librtlsdr has.
+ */
+#define NBUFS  16
+
+struct src_rtlsdr {
+	rtlsdr_dev_t *dev;
+	pthread_t thread;
+	int running;
+};
+
+static int rtlsdr_src_open(struct source *sp, const char *arg);
+static int rtlsdr_src_start(struct source *sp);
+static void rtlsdr_src_stop(struct source *sp);
+static void rtlsdr_src_close(struct source *sp);
+static void *rx_thread(void *arg);
+static void rx_callback(unsigned char *buf, uint32_t len, void *ctx);
+static int nearest_gain(int target_gain, rtlsdr_dev_t *dev);
+
+const struct source_ops source_rtlsdr = {
+	.name = "rtlsdr",
+	.open = rtlsdr_src_open,
+	.start = rtlsdr_src_start,
+	.stop = rtlsdr_src_stop,
+	.close = rtlsdr_src_close,
+};
+
+/*
+ * The arg is the index of the device, 0 if empty.
+ */
+static int rtlsdr_src_open(struct source *sp, const char *arg)
+{
+	const struct source_conf *conf = sp->conf;
+	struct src_rtlsdr *rp;
+	unsigned int device_count, devx;
+	char manuf[BUF_MAX], prod[BUF_MAX], sernum[BUF_MAX];
+	unsigned int real_rate;
+	int gain;
+	char *end;
+	int rc;
+
+	devx = strtoul(arg, &end, 10);
+	if (*end != 0) {
+		fprintf(stderr, TAG ": Invalid device index `%s'\n", arg);
+		return -1;
+	}
+
+	if ((rp = malloc(sizeof(struct src_rtlsdr))) == NULL)
+		goto err_alloc;
+	memset(rp, 0, sizeof(struct src_rtlsdr));
+	if (ring_init(&sp->ring, NBUFS, DEFAULT_BUF_LENGTH) != 0) {
+		fprintf(stderr, TAG ": No core\n");
+		goto err_ring;
+	}
+
+	device_count = rtlsdr_get_device_count();
+	if (!device_count) {
+		fprintf(stderr, TAG ": No supported devices found\n");
+		goto err_dev;
+	}
+	printf("Devices found: %u\n", device_count);
+	if (devx >= device_count) {
+		fprintf(stderr, TAG ": No device %u\n", devx);
+		goto err_dev;
+	}
+
+	printf("Using device: %s\n", rtlsdr_get_device_name(devx));
+
+	rc = rtlsdr_open(&rp->dev, devx);
+	if (rc < 0) {
+		fprintf(stderr, TAG ": Error opening device %d: %d\n",
+		    devx, rc);
+		goto err_dev;
+	}
+
+	rc = rtlsdr_get_usb_strings(rp->dev, manuf, prod, sernum);
+	if (rc < 0) {
+		fprintf(stderr, TAG ": Error getting strings: %d\n", rc);
+		goto err_set;
+	}
+	printf("  %d:  %s, %s, SN: %s\n", devx, manuf, prod, sernum);
+
+	rc = rtlsdr_set_tuner_gain_mode(rp->dev, 0);
+	if ((gain = conf->gain) == (~0)) {
+		rc = rtlsdr_set_tuner_gain_mode(rp->dev, 0);
+		if (rc < 0) {
+			fprintf(stderr,
+			    TAG ": Error setting auto gain: %d\n", rc);
+			goto err_set;
+		}
+	} else {
+		rc = rtlsdr_set_tuner_gain_mode(rp->dev, 1);
+		gain = nearest_gain(gain * 10, rp->dev);
+		rc = rtlsdr_set_tuner_gain(rp->dev, gain);
+		if (rc < 0) {
+			fprintf(stderr,
+			    TAG ": Error setting gain %d/10: %d\n", gain, rc);
+			goto err_set;
+		}
+		printf("Gain set to %d\n", gain/10);
+	}
+
+	rtlsdr_set_agc_mode(rp->dev, 1);
+
+	rc = rtlsdr_set_center_freq(rp->dev, conf->freq);
+	if (rc < 0) {
+		fprintf(stderr,
+		    TAG ": Error setting center frequency: %d\n", rc);
+		goto err_set;
+	}
+
+	rc = rtlsdr_set_freq_correction(rp->dev, conf->ppm);
+	if (rc == -2) {
+		; /* same correction already in effect */
+	} else if (rc < 0) {
+		fprintf(stderr, TAG ": Error setting correction: %d\n", rc);
+		goto err_set;
+	} else {
+		printf("Correction set to %d\n", rc);
+	}
+
+	rc = rtlsdr_set_sample_rate(rp->dev, conf->rate);
+	if (rc < 0) {
+		fprintf(stderr, TAG ": Error setting rate: %d\n", rc);
+		goto err_set;
+	}
+	real_rate = rtlsdr_get_sample_rate(rp->dev);
+	printf("Sample rate set to %u (desired %lu)\n", real_rate, conf->rate);
+	if (real_rate < conf->rate - conf->rate/544 ||
+	    real_rate > conf->rate + conf->rate/544) {
+		fprintf(stderr, TAG ": Set rate %u not acceptable, need %lu\n",
+		    real_rate, conf->rate);
+		goto err_set;
+	}
+
+	/* Reset endpoint before we start reading from it (mandatory) */
+	rc = rtlsdr_reset_buffer(rp->dev);
+	if (rc < 0) {
+		fprintf(stderr, TAG ": Error resetting: %d\n", rc);
+		goto err_set;
+	}
+
+	sp->format = SOURCE_CU8;
+	sp->live = 1;
+	sp->use_ring = 1;
+	sp->priv = rp;
+	return 0;
+
+err_set:
+	rtlsdr_close(rp->dev);
+err_dev:
+	ring_fini(&sp->ring);
+err_ring:
+	free(rp);
+err_alloc:
+	return -1;
+}
+
+static int rtlsdr_src_start(struct source *sp)
+{
+	struct src_rtlsdr *rp = sp->priv;
+
+	if (pthread_create(&rp->thread, NULL, rx_thread, sp) != 0)
+		return -1;
+	rp->running = 1;
+	return 0;
+}
+
+static void rtlsdr_src_stop(struct source *sp)
+{
+	struct src_rtlsdr *rp = sp->priv;
+
+	if (rp->running) {
+		rtlsdr_cancel_async(rp->dev);
+		pthread_join(rp->thread, NULL);
+		rp->running = 0;
+	}
+}
+
+static void rtlsdr_src_close(struct source *sp)
+{
+	struct src_rtlsdr *rp = sp->priv;
+
+	rtlsdr_src_stop(sp);
+	rtlsdr_close(rp->dev);
+	ring_fini(&sp->ring);
+	free(rp);
+}
+
+/*
+ * librtlsdr calls back from here, until the device goes away or we
+ * cancel it, and then the source ends.
+ */
+static void *rx_thread(void *arg)
+{
+	struct source *sp = arg;
+	struct src_rtlsdr *rp = sp->priv;
+
+#if 1
+	/* Flushing is cargo-culted from rtl_adsb. */
+	sleep(1);
+	rtlsdr_read_sync(rp->dev, NULL, 4096, NULL);
+#endif
+
+	rtlsdr_read_async(rp->dev, rx_callback, sp, 0, DEFAULT_BUF_LENGTH);
+	ring_close(&sp->ring);
+	return NULL;
+}
+
+/*
+ * The ring counts the drops, and the decoder reports them with the stats.
+ */
+static void rx_callback(unsigned char *buf, uint32_t len, void *ctx)
+{
+	struct source *sp = ctx;
+	unsigned char *p;
+
+	if ((p = ring_claim(&sp->ring)) == NULL)
+		return;
+	if (len > DEFAULT_BUF_LENGTH)
+		len = DEFAULT_BUF_LENGTH;
+	memcpy(p, buf, len);
+	ring_commit(&sp->ring, len);
+}
+
+/* taken from rtl_rm */
+static int nearest_gain(int target_gain, rtlsdr_dev_t *dev)
+{
+	int i, err1, err2, count, close_gain;
+	int* gains;
+	count = rtlsdr_get_tuner_gains(dev, NULL);
+	if (count <= 0) {
+		return 0;
+	}
+	gains = malloc(sizeof(int) * count);
+	count = rtlsdr_get_tuner_gains(dev, gains);
+	close_gain = gains[0];
+	for (i=0; i<count; i++) {
+		err1 = abs(target_gain - close_gain);
+		err2 = abs(target_gain - gains[i]);
+		if (err2 < err1) {
+			close_gain = gains[i];
+		}
+	}
+	free(gains);
+	return close_gain;
+}
@@ -0,0 +1,151 @@
+/*
+ * The source: a generator of UAT frames in noise
+ *
+ * This makes a period of valid frames, ADS-B short, long, and Uplink in
+ * turn, in the format that the decoder wants, and then hands it out over
+ * and over. So, the decoder can be tested and timed without a device,
+ * and the cost of making the signal is not in the measurement.
+ * The signal itself is made by synth.c, the same as in uatgen.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "source.h"
+#include "synth.h"
+
+#define TAG "synth"
+
+#define SYNTH_FRAMES     21	/* in a period, every kind 7 times */
+#define SYNTH_BUF  (256*1024)
+
+struct src_synth {
+	unsigned char *mem;	/* the period */
+	size_t size, off;
+	size_t unit;		/* bytes in 8 samples */
+	int endless;
+	unsigned long left;	/* bytes to hand out */
+};
+
+static int synth_open(struct source *sp, const char *arg);
+static int synth_start(struct source *sp);
+static int synth_get(struct source *sp, const void **pp, size_t *lenp);
+static void synth_close(struct source *sp);
+
+const struct source_ops source_synth = {
+	.name = "synth",
+	.open = synth_open,
+	.start = synth_start,
+	.get = synth_get,
+	.close = synth_close,
+};
+
+/*
+ * The arg is "seconds,snr": how much to generate, 0 for no end, and
+ * the signal to noise ratio in dB in the band of the samples.
+ * Both are optional, and default to 10 seconds at 20 dB.
+ */
+static int synth_open(struct source *sp, const char *arg)
+{
+	const struct source_conf *conf = sp->conf;
+	struct synth_conf yconf;
+	struct synth synth;
+	struct src_synth *yp;
+	double secs, snr;
+	size_t nsamples;
+	char *end;
+
+	secs = 10;
+	snr = 20;
+	if (*arg != 0) {
+		secs = strtod(arg, &end);
+		if (*end == ',')
+			snr = strtod(end + 1, &end);
+		if (*end != 0 || secs < 0) {
+			fprintf(stderr, TAG ": Invalid arguments `%s'\n", arg);
+			return -1;
+		}
+	}
+
+	if ((yp = malloc(sizeof(struct src_synth))) == NULL)
+		goto err_alloc;
+	memset(yp, 0, sizeof(struct src_synth));
+
+	/*
+	 * A multiple of 8 samples keeps Airspy's fs/4 in phase, and packs.
+	 * Every buffer is whole units of 8, too.
+	 */
+	nsamples = (double) SYNTH_FRAMES * SYNTH_SLOT * conf->rate / SYNTH_BAUD;
+	nsamples &= ~7;
+	yp->unit = (conf->format == SOURCE_RAW12) ? 12 : 16;
+	yp->size = nsamples / 8 * yp->unit;
+	if ((yp->mem = malloc(yp->size)) == NULL)
+		goto err_mem;
+
+	memset(&yconf, 0, sizeof(yconf));
+	if (conf->format == SOURCE_CU8)
+		yconf.format = SYNTH_CU8;
+	else if (conf->format == SOURCE_RAW12)
+		yconf.format = SYNTH_RAW12;
+	else
+		yconf.format = SYNTH_RAW16;
+	yconf.rate = conf->rate;
+	yconf.snr = snr;
+	if (synth_init(&synth, &yconf) != 0)
+		goto err_init;
+	synth.limit = nsamples;
+	synth_gen(&synth, yp->mem, nsamples);
+	synth_fini(&synth);
+
+	yp->endless = (secs == 0);
+	yp->left = (unsigned long) (secs * conf->rate / 8) * yp->unit;
+
+	sp->priv = yp;
+	return 0;
+
+err_init:
+	free(yp->mem);
+err_mem:
+	free(yp);
+err_alloc:
+	fprintf(stderr, TAG ": Unable to make the signal\n");
+	return -1;
+}
+
+static int synth_start(struct source *sp)
+{
+	return 0;
+}
+
+static int synth_get(struct source *sp, const void **pp, size_t *lenp)
+{
+	struct src_synth *yp = sp->priv;
+	size_t n;
+
+	if (yp->off == yp->size)
+		yp->off = 0;
+	n = yp->size - yp->off;
+	if (n > SYNTH_BUF - SYNTH_BUF % yp->unit)
+		n = SYNTH_BUF - SYNTH_BUF % yp->unit;
+	if (!yp->endless) {
+		if (yp->left == 0)
+			return -1;
+		if (n > yp->left)
+			n = yp->left;
+		yp->left -= n;
+	}
+	*pp = yp->mem + yp->off;
+	*lenp = n;
+	yp->off += n;
+	return 1;
+}
+
+static void synth_close(struct source *sp)
+{
+	struct src_synth *yp = sp->priv;
+
+	free(yp->mem);
+	free(yp);
+}
@@ -0,0 +1,173 @@
+#!/usr/bin/python3
+#
+# The sensitivity sweep: how many frames every configuration of ruat
+# decodes out of generated traffic, by SNR and carrier offset
+#
+# For every point, uatgen makes a capture with its truth, and every
+# configuration decodes it. A frame counts if it's exactly one that was
+# sent, and it's false if it was not sent at all. The CPU time is that of
+# ruat with all of its threads, so cpu_per_s over 1.0 means that the
+# configuration would not keep up on this machine.
+#
+# The output is CSV, one line for every configuration at every point.
+#
+
+import os
+import resource
+import subprocess
+import sys
+import tempfile
+
+TAG="sweep"
+
+DEFAULT_CONFIGS = ["-m run", "-m run -s 0", "-m run -e 0",
+                   "-m corr", "-m corr -e 0"]
+
+class ParamError(Exception):
+    pass
+
+def parse_list(arg):
+    """Either a list of numbers, "1,2,3", or a range, "start:stop:step"."""
+    try:
+        if ':' in arg:
+            v = [float(x) for x in arg.split(':')]
+            if len(v) != 3 or v[2] <= 0:
+                raise ParamError("Invalid range " + arg)
+            ret = []
+            x = v[0]
+            while x <= v[1] + v[2] / 1000:
+                ret.append(round(x, 6))
+                x += v[2]
+            return ret
+        return [float(x) for x in arg.split(',')]
+    except ValueError:
+        raise ParamError("Invalid numbers " + arg)
+
+class Param:
+    def __init__(self, argv):
+        skip = 1;  # Do skip=1 for full argv.
+        #: Seconds of traffic at every point
+        self.secs = 20.0
+        #: Bursts per second
+        self.density = 200.0
+        self.snrs = parse_list("0:24:2")
+        self.cfos = [0.0]
+        self.seed = 1
+        #: Where ruat and uatgen are
+        self.bindir = os.path.dirname(os.path.abspath(argv[0]))
+        self.configs = []
+        self.outname = None
+        for i in range(len(argv)):
+            if skip:
+                skip = 0
+                continue
+            arg = argv[i]
+            if len(arg) != 0 and arg[0] == '-':
+                if i+1 == len(argv):
+                    raise ParamError("Parameter %s needs an argument" % arg)
+                val = argv[i+1]
+                skip = 1;
+                if arg == "-n":
+                    self.secs = parse_list(val)[0]
+                elif arg == "-d":
+                    self.density = parse_list(val)[0]
+                elif arg == "-s":
+                    self.snrs = parse_list(val)
+                elif arg == "-c":
+                    self.cfos = parse_list(val)
+                elif arg == "-S":
+                    self.seed = int(parse_list(val)[0])
+                elif arg == "-b":
+                    self.bindir = val
+                elif arg == "-C":
+                    self.configs.append(val)
+                elif arg == "-o":
+                    self.outname = val
+                else:
+                    raise ParamError("Unknown parameter " + arg)
+            else:
+                raise ParamError("Positional parameter supplied")
+        if len(self.configs) == 0:
+            self.configs = DEFAULT_CONFIGS
+
+def cpu_children():
+    ru = resource.getrusage(resource.RUSAGE_CHILDREN)
+    return ru.ru_utime + ru.ru_stime
+
+def read_truth(name):
+    sent = set()
+    with open(name) as f:
+        for line in f:
+            if line.startswith('#'):
+                continue
+            sent.add(line.split()[2])
+    return sent
+
+# Returns the frames, and the seconds of CPU that it took.
+def decode(par, config, capname):
+    cmd = [os.path.join(par.bindir, "ruat"), "-f", capname] + config.split()
+    t0 = cpu_children()
+    res = subprocess.run(cmd, stdout=subprocess.PIPE,
+                         stderr=subprocess.DEVNULL, universal_newlines=True)
+    cpu = cpu_children() - t0
+    if res.returncode != 0:
+        raise ParamError("ruat %s failed: %d" % (config, res.returncode))
+    got = set()
+    for line in res.stdout.splitlines():
+        # Frames only; the bad ones and the stats are not
+        if len(line) != 0 and line[0] in "+-":
+            got.add(line.split(' ')[0])
+    return got, cpu
+
+def main(args):
+    try:
+        par = Param(args)
+    except ParamError as e:
+        print(TAG+": %s" % e, file=sys.stderr)
+        print("Usage:", TAG+" [-n seconds] [-d bursts_per_second]"
+              " [-s snr_list] [-c cfo_list] [-S seed]\n"
+              "       [-b bindir] [-C \"ruat options\"]... [-o outfile]",
+              file=sys.stderr)
+        print("Lists: 1,2,3 or start:stop:step", file=sys.stderr)
+        return 1
+
+    if par.outname:
+        outfp = open(par.outname, 'w')
+    else:
+        outfp = sys.stdout
+
+    print("config,snr_db,cfo_hz,sent,decoded,false,yield,false_per_min,"
+          "cpu_s,cpu_per_s", file=outfp)
+    with tempfile.TemporaryDirectory(prefix=TAG) as tmpdir:
+        capname = os.path.join(tmpdir, "capture.cu8")
+        truthname = os.path.join(tmpdir, "truth.txt")
+        for cfo in par.cfos:
+            for snr in par.snrs:
+                cmd = [os.path.join(par.bindir, "uatgen"),
+                       "-n", str(par.secs), "-s", str(snr), "-c", str(cfo),
+                       "-d", str(par.density), "-S", str(par.seed),
+                       "-w", truthname, "-o", capname]
+                if subprocess.run(cmd).returncode != 0:
+                    print(TAG+": uatgen failed", file=sys.stderr)
+                    return 1
+                sent = read_truth(truthname)
+                for config in par.configs:
+                    try:
+                        got, cpu = decode(par, config, capname)
+                    except ParamError as e:
+                        print(TAG+": %s" % e, file=sys.stderr)
+                        return 1
+                    good = len(got & sent)
+                    false = len(got - sent)
+                    print("\"%s\",%g,%g,%d,%d,%d,%.4f,%.2f,%.3f,%.4f" %
+                          (config, snr, cfo, len(sent), good, false,
+                           good / max(len(sent), 1),
+                           false * 60.0 / par.secs,
+                           cpu, cpu / par.secs), file=outfp)
+                    outfp.flush()
+                print(TAG+": snr %g cfo %g done" % (snr, cfo),
+                      file=sys.stderr)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
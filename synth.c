@@ -0,0 +1,287 @@
+/*
+ * The synthesizer, see synth.h
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fec.h"
+#include "synth.h"
+
+#define TAG "synth"
+
+#define SYNC_A  0xEACDDA4E2ULL
+#define SYNC_U  0x153225B1DULL
+
+#define SYNTH_DEV     312500	/* deviation, Hz */
+#define SYNTH_LEAD       300	/* bits before the first burst */
+#define SYNTH_GUARD      100	/* bits at least between the bursts */
+
+static void synth_put(signed char *bits, uint64_t v, int n);
+static void synth_bytes(signed char *bits, const unsigned char *p, int n);
+static void synth_burst(struct synth *yp);
+static void synth_pack12(unsigned char *cp, const uint16_t *s);
+static uint64_t synth_rand(struct synth *yp);
+static double synth_gauss(struct synth *yp);
+
+int synth_init(struct synth *yp, const struct synth_conf *conf)
+{
+	struct rs_code *codes;
+
+	memset(yp, 0, sizeof(struct synth));
+	yp->conf = *conf;
+	if (yp->conf.kinds == 0) {
+		yp->conf.kinds = (1 << SYNTH_AS) | (1 << SYNTH_AL) |
+		    (1 << SYNTH_UP);
+	}
+	yp->rnd = conf->seed ? conf->seed : 0x2545F4914F6CDD1DULL;
+
+	if ((codes = malloc(3 * sizeof(struct rs_code))) == NULL) {
+		fprintf(stderr, TAG ": No core\n");
+		return -1;
+	}
+	if (rs_code_init(&codes[0], &gf_uat, gpoly_uat_up, 92, 20, 120) != 0 ||
+	    rs_code_init(&codes[1], &gf_uat, gpoly_uat_as, 30, 12, 120) != 0 ||
+	    rs_code_init(&codes[2], &gf_uat, gpoly_uat_al, 48, 14, 120) != 0) {
+		fprintf(stderr, TAG ": rs_code_init error\n");
+		free(codes);
+		return -1;
+	}
+	yp->codes = codes;
+
+	/*
+	 * The SNR is of the power of the signal to that of the noise, so
+	 * every component of the noise has sigma of amp / sqrt(2 * snr).
+	 */
+	yp->sps = (double) conf->rate / SYNTH_BAUD;
+	yp->amp = (conf->format == SYNTH_CU8) ? 100.0 : 1000.0;
+	yp->sigma = yp->amp / sqrt(2 * pow(10, conf->snr / 10));
+	yp->dphi = 2 * M_PI * SYNTH_DEV / conf->rate;
+	yp->dcfo = 2 * M_PI * conf->cfo / conf->rate;
+	yp->next = SYNTH_LEAD * yp->sps;
+	return 0;
+}
+
+void synth_fini(struct synth *yp)
+{
+	rs_code_fin(&yp->codes[2]);
+	rs_code_fin(&yp->codes[1]);
+	rs_code_fin(&yp->codes[0]);
+	free(yp->codes);
+}
+
+/*
+ * Make a packet of random data, and put it into frame[] as it goes on
+ * the air, with the parity, and the Uplink interleaved as in Anx.10.
+ * The data as ruat prints it goes into bp->data. Returns the length.
+ */
+int synth_packet(struct synth *yp, int kind, unsigned char *frame,
+    struct synth_burst *bp)
+{
+	unsigned char blk[6][92];
+	int i, b;
+
+	bp->kind = kind;
+	switch (kind) {
+	case SYNTH_AS:		/* payload type 0 */
+		for (i = 0; i < 18; i++)
+			frame[i] = synth_rand(yp);
+		frame[0] &= 7;
+		rs_rem(&yp->codes[1], frame + 18, 18, frame);
+		bp->dlen = 18;
+		memcpy(bp->data, frame, 18);
+		return 30;
+	case SYNTH_AL:		/* payload type 1 */
+		for (i = 0; i < 34; i++)
+			frame[i] = synth_rand(yp);
+		frame[0] = (frame[0] & 7) | 8;
+		rs_rem(&yp->codes[2], frame + 34, 34, frame);
+		bp->dlen = 34;
+		memcpy(bp->data, frame, 34);
+		return 48;
+	default:
+		for (b = 0; b < 6; b++) {
+			for (i = 0; i < 72; i++)
+				blk[b][i] = synth_rand(yp);
+			rs_rem(&yp->codes[0], blk[b] + 72, 72, blk[b]);
+			memcpy(bp->data + b*72, blk[b], 72);
+		}
+		for (i = 0; i < 92; i++) {
+			for (b = 0; b < 6; b++)
+				frame[i*6 + b] = blk[b][i];
+		}
+		bp->dlen = 6*72;
+		return 6*92;
+	}
+}
+
+/*
+ * Generate the next nsamples of the stream. CU8 is I/Q at the carrier,
+ * RAW16 is real with the carrier at fs/4, as Airspy has it, so its phase
+ * goes by the number of the sample, and the buffers had better start at
+ * a multiple of 4 if they are to be mixed by themselves. RAW12 is RAW16
+ * packed, so nsamples has to be a multiple of 8 for it.
+ */
+void synth_gen(struct synth *yp, void *buf, size_t nsamples)
+{
+	unsigned char *cp = buf;
+	uint16_t *wp = buf;
+	uint16_t pack[8];
+	double t, v, sigma = yp->sigma, amp = yp->amp;
+	size_t n;
+	int b;
+
+	for (n = 0; n < nsamples; n++, yp->pos++) {
+		if (yp->nbits == 0 && yp->pos >= yp->next)
+			synth_burst(yp);
+		b = -1;
+		if (yp->nbits != 0 && (t = yp->pos - yp->start) >= 0) {
+			t /= yp->sps;
+			if (t < yp->nbits)
+				b = yp->bits[(int) t];
+			else
+				yp->nbits = 0;
+		}
+		if (b >= 0) {
+			yp->phi += (b ? yp->dphi : -yp->dphi) + yp->dcfo;
+			if (yp->phi > M_PI)
+				yp->phi -= 2 * M_PI;
+			else if (yp->phi < -M_PI)
+				yp->phi += 2 * M_PI;
+		}
+
+		if (yp->conf.format == SYNTH_CU8) {
+			v = 127.5 + synth_gauss(yp) * sigma;
+			if (b >= 0)
+				v += amp * cos(yp->phi);
+			*cp++ = (v < 0) ? 0 : (v > 255) ? 255 : v;
+			v = 127.5 + synth_gauss(yp) * sigma;
+			if (b >= 0)
+				v += amp * sin(yp->phi);
+			*cp++ = (v < 0) ? 0 : (v > 255) ? 255 : v;
+		} else {
+			v = 2048 + synth_gauss(yp) * sigma;
+			if (b >= 0)
+				v += amp * cos(yp->phi + M_PI/2 * (yp->pos&3));
+			v = (v < 0) ? 0 : (v > 4095) ? 4095 : v;
+			if (yp->conf.format == SYNTH_RAW16) {
+				*wp++ = v;
+			} else {
+				pack[n & 7] = v;
+				if ((n & 7) == 7) {
+					synth_pack12(cp, pack);
+					cp += 12;
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Put the next burst on the air, and find the slot of the one after it.
+ * With a density, the bursts come at random, as the traffic does, but
+ * never over each other.
+ */
+static void synth_burst(struct synth *yp)
+{
+	unsigned char frame[6*92];
+	struct synth_burst burst;
+	double len, gap;
+	int kind, n;
+
+	do {
+		kind = SYNTH_AS + yp->turn;
+		yp->turn = (yp->turn + 1) % 3;
+	} while (!(yp->conf.kinds & (1 << kind)));
+
+	n = synth_packet(yp, kind, frame, &burst);
+	synth_put(yp->bits, (kind == SYNTH_UP) ? SYNC_U : SYNC_A, 36);
+	synth_bytes(yp->bits + 36, frame, n);
+
+	len = (36 + n*8) * yp->sps;
+	yp->start = yp->next + yp->conf.timing * yp->sps;
+	burst.start = ceil(yp->start);
+	burst.end = ceil(yp->start + len);
+
+	if (yp->conf.density == 0) {
+		gap = SYNTH_SLOT * yp->sps;
+	} else {
+		gap = -log((synth_rand(yp) + 1.0) / 4294967297.0) *
+		    yp->conf.rate / yp->conf.density;
+		if (gap < len + SYNTH_GUARD * yp->sps)
+			gap = len + SYNTH_GUARD * yp->sps;
+	}
+	yp->next += gap;
+
+	if (yp->limit != 0 && burst.end > yp->limit) {
+		yp->next = HUGE_VAL;
+		return;
+	}
+	yp->nbits = 36 + n*8;
+	if (yp->truth)
+		yp->truth(yp->truth_arg, &burst);
+}
+
+/*
+ * The packing of Airspy is of 3 words of 32 bits, little-endian, with
+ * the samples from the top down: s[0] is the bits 31..20 of the first.
+ */
+static void synth_pack12(unsigned char *cp, const uint16_t *s)
+{
+	cp[0] = s[2] >> 4;
+	cp[1] = s[1];
+	cp[2] = (s[0] & 0xf) << 4 | s[1] >> 8;
+	cp[3] = s[0] >> 4;
+	cp[4] = (s[4] & 0xf) << 4 | s[5] >> 8;
+	cp[5] = s[4] >> 4;
+	cp[6] = s[3];
+	cp[7] = (s[2] & 0xf) << 4 | s[3] >> 8;
+	cp[8] = s[7];
+	cp[9] = (s[6] & 0xf) << 4 | s[7] >> 8;
+	cp[10] = s[6] >> 4;
+	cp[11] = s[5];
+}
+
+static void synth_put(signed char *bits, uint64_t v, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		bits[i] = (v >> (n - 1 - i)) & 1;
+}
+
+static void synth_bytes(signed char *bits, const unsigned char *p, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		synth_put(bits + 8*i, p[i], 8);
+}
+
+/* xorshift64*, so that every run with the same seed is the same */
+static uint64_t synth_rand(struct synth *yp)
+{
+	yp->rnd ^= yp->rnd >> 12;
+	yp->rnd ^= yp->rnd << 25;
+	yp->rnd ^= yp->rnd >> 27;
+	return (yp->rnd * 0x2545F4914F6CDD1DULL) >> 32;
+}
+
+static double synth_gauss(struct synth *yp)
+{
+	double u, v, r;
+
+	if (yp->has_spare) {
+		yp->has_spare = 0;
+		return yp->spare;
+	}
+	u = (synth_rand(yp) + 1.0) / 4294967297.0;
+	v = (synth_rand(yp) + 1.0) / 4294967297.0;
+	r = sqrt(-2 * log(u));
+	yp->spare = r * sin(2 * M_PI * v);
+	yp->has_spare = 1;
+	return r * cos(2 * M_PI * v);
+}
@@ -0,0 +1,81 @@
+/*
+ * The synthesizer: UAT bursts in noise, and the truth about them
+ *
+ * This makes valid ADS-B and Uplink packets, with the parity and the
+ * interleaving of Annex 10, modulates them at any sample rate, and adds
+ * the noise. It's behind the synth source (src_synth.c), the uatgen tool,
+ * and the benchmarks, so that all of them agree on what a burst is.
+ *
+ * The stream goes on from one call of synth_gen() to the next, and every
+ * burst is told to the truth callback when it starts, with the bytes that
+ * ruat should print for it.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#define SYNTH_CU8    0	/* the same as SOURCE_CU8 */
+#define SYNTH_RAW16  1	/* the same as SOURCE_RAW16 */
+#define SYNTH_RAW12  2	/* the same as SOURCE_RAW12 */
+
+/* The kinds are the types of the binary records of ruat, see serve.h */
+#define SYNTH_AS  1	/* ADS-B short */
+#define SYNTH_AL  2	/* ADS-B long */
+#define SYNTH_UP  3	/* Uplink */
+
+#define SYNTH_BAUD     1041667	/* UAT bits per second */
+#define SYNTH_SLOT     6250	/* bits, or 6 ms: an Uplink and a gap */
+#define SYNTH_BITS_MAX  (36 + 4416)	/* the sync and an Uplink */
+#define SYNTH_DATA_MAX  (6 * 72)
+
+struct synth_conf {
+	int format;		/* SYNTH_CU8, SYNTH_RAW16, or SYNTH_RAW12 */
+	unsigned long rate;	/* samples per second */
+	double snr;		/* dB, in the band of the samples */
+	double cfo;		/* Hz, the offset of the carrier */
+	double timing;		/* bits, added to the start of bursts */
+	double density;		/* bursts per second, 0 for one a slot */
+	unsigned int kinds;	/* 1 << SYNTH_AS and so on, 0 for all */
+	uint64_t seed;		/* 0 for the default */
+};
+
+struct synth_burst {
+	int kind;
+	unsigned long long start;	/* the first sample of the sync */
+	unsigned long long end;		/* the sample after the last bit */
+	int dlen;
+	unsigned char data[SYNTH_DATA_MAX];	/* as ruat prints it */
+};
+
+struct rs_code;
+
+struct synth {
+	struct synth_conf conf;
+	struct rs_code *codes;	/* Uplink, short, long */
+	uint64_t rnd;
+	double spare;		/* the other half of Box-Muller */
+	int has_spare;
+
+	double sps;		/* samples per bit */
+	double amp, sigma;
+	double dphi, dcfo;	/* per sample */
+	double phi;
+
+	unsigned long long pos;		/* the next sample */
+	/* No burst ends past this, so a period can be repeated; 0 if none */
+	unsigned long long limit;
+	double next;		/* the slot of the next burst, in samples */
+	int turn;		/* the kinds go in turn */
+
+	signed char bits[SYNTH_BITS_MAX];
+	int nbits;		/* of the burst on the air, 0 if none */
+	double start;
+
+	void (*truth)(void *arg, const struct synth_burst *bp);
+	void *truth_arg;
+};
+
+int synth_init(struct synth *yp, const struct synth_conf *conf);
+void synth_fini(struct synth *yp);
+int synth_packet(struct synth *yp, int kind, unsigned char *frame,
+    struct synth_burst *bp);
+void synth_gen(struct synth *yp, void *buf, size_t nsamples);
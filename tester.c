@@ -2,19 +2,51 @@
  * test
  */
 #include <assert.h>
+#include <math.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include "fec.h"
+#include "fir.h"
+#include "serve.h"
+#include "source.h"	/* and ring.h */
+#include "synth.h"
+#include "upd.h"
+#include "writer.h"
 
 #define TAG "tester"
 
+/*
+ * The timing is only informational, so we do not care if rdtsc is
+ * not serializing. Where there is no TSC, we count nanoseconds instead.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES_UNIT "cycles"
+static unsigned long long cycles(void) { return __rdtsc(); }
+#else
+#define CYCLES_UNIT "ns"
+static unsigned long long cycles(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
 static void test_gen_lc(void);
 static void test_field_lc(struct gf *f);
 static void test_gen_uat(void);
+static void test_gftab(void);
 static void test_gen_gen_qrc(void);
 static void test_gen_gen_uat(void);
+static void test_mul_add(unsigned int poly);
 static void test_gen_gen(unsigned int poly, int rpow, int len,
     const unsigned char *sample);
 static void test_rem_qrc(void);
@@ -22,8 +54,26 @@ static void test_rem_uat1(void);
 static void test_rem_uat2(void);
 static void test_rem_uat3(void);
 static void test_rem(struct gf *f, int mlen, const unsigned char *msg,
-    unsigned int ppoly, int gplen, const unsigned char *gpoly,
+    unsigned int ppoly, int gplen, const unsigned char *gpoly, int fcr,
     const unsigned char *sample);
+static void test_rs_uat(void);
+static void test_rs(struct gf *f, int n, int nroots, int fcr);
+static void test_rs_ilv(struct gf *f);
+static void test_rs_eras(struct gf *f, int n, int nroots, int fcr);
+static void time_check_uat(int level);
+static void test_ring(void);
+static void *test_ring_producer(void *arg);
+static void test_writer(void);
+static void test_serve(void);
+static void test_source(void);
+static void test_synth(void);
+static void test_fir(void);
+static double test_fir_tone(double hz, double *dphi);
+static void test_fir_packed(void);
+static int test_fir_run(int packed, int ssse3, const unsigned char *raw,
+    int *out);
+static void test_upd(void);
+static int serve_connect(struct server *s, const char *path, int kind);
 
 /*
  * This is the sample GF(2^8) taken from 1983 Lin & Costello.
@@ -331,14 +381,37 @@ static char gf256_8_4_3_2_0[256][8] = {
 
 int main(int argc, char **argv)
 {
-	test_gen_lc();
-	test_gen_uat();
-	test_gen_gen_qrc();
-	test_gen_gen_uat();
-	test_rem_qrc();
-	test_rem_uat1();
-	test_rem_uat2();
-	test_rem_uat3();
+	int level;
+
+	test_ring();
+	test_writer();
+	test_serve();
+	test_source();
+	test_synth();
+	test_fir();
+	test_upd();
+
+	/*
+	 * Everything that multiplies polynomials runs through the kernels,
+	 * so we run all the tests with each level of SIMD that the CPU has.
+	 */
+	for (level = GF_SIMD_NONE; level <= GF_SIMD_AVX2; level++) {
+		if (gf_simd(level) != level)
+			break;
+		test_gen_lc();
+		test_gen_uat();
+		test_gftab();
+		test_gen_gen_qrc();
+		test_gen_gen_uat();
+		test_mul_add(GF256_POLY_LC);
+		test_mul_add(GF256_POLY_UAT);
+		test_rem_qrc();
+		test_rem_uat1();
+		test_rem_uat2();
+		test_rem_uat3();
+		test_rs_uat();
+		time_check_uat(level);
+	}
 	return 0;
 }
 
@@ -476,6 +549,85 @@ static void test_gen_uat(void)
 	gf_fin(&field);
 }
 
+/*
+ * The tables that gfgen.py made must be the same as what gf_init() makes,
+ * and the generators the same as what p_gen_gen() makes.
+ */
+static void test_gftab(void)
+{
+	static const struct {
+		const unsigned char *gpoly;
+		int nroots;
+	} gtab[3] = {
+		{ gpoly_uat_up, 20 },
+		{ gpoly_uat_as, 12 },
+		{ gpoly_uat_al, 14 },
+	};
+	const struct gf *t = &gf_uat;
+	struct gf field;
+	unsigned char buf[RS_MAXROOTS + 1];
+	unsigned int a, b, v, ref;
+	int i;
+	int rc;
+
+	rc = gf_init(&field, GF256_POLY_UAT);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": gf_init(0x%x) error: %d\n",
+		    GF256_POLY_UAT, rc);
+		exit(1);
+	}
+
+	if (memcmp(t->field, field.field, 256) != 0 ||
+	    memcmp(t->index, field.index, 256) != 0 ||
+	    memcmp(t->nib, field.nib, 256 * 32) != 0 ||
+	    memcmp(t->exp, field.exp, GF_EXP_LEN) != 0 ||
+	    memcmp(t->log, field.log, 256 * sizeof(t->log[0])) != 0) {
+		fprintf(stderr, TAG ": gftab field mismatch\n");
+		exit(1);
+	}
+
+	for (i = 0; i < 3; i++) {
+		rc = p_gen_gen(&field, buf, 120, 120 + gtab[i].nroots);
+		if (rc != 0) {
+			fprintf(stderr,
+			    TAG ": p_gen_gen(0x%x,120,%d) error: %d\n",
+			    GF256_POLY_UAT, 120 + gtab[i].nroots, rc);
+			exit(1);
+		}
+		if (memcmp(gtab[i].gpoly, buf, gtab[i].nroots + 1) != 0) {
+			fprintf(stderr, TAG ": gftab gpoly %d mismatch\n",
+			    gtab[i].nroots);
+			exit(1);
+		}
+	}
+
+	/*
+	 * The gf_mult() has no test for zero, so check it against
+	 * the schoolbook shift-and-add over all pairs, zero included.
+	 */
+	for (a = 0; a < 256; a++) {
+		for (b = 0; b < 256; b++) {
+			ref = 0;
+			v = a;
+			for (i = 0; i < 8; i++) {
+				if (b & (1 << i))
+					ref ^= v;
+				v <<= 1;
+				if (v & 0x100)
+					v ^= GF256_POLY_UAT;
+			}
+			if (gf_mult(t, a, b) != ref) {
+				fprintf(stderr, TAG ": gf_mult(0x%02x,0x%02x)"
+				    " 0x%02x expected 0x%02x\n",
+				    a, b, gf_mult(t, a, b), ref);
+				exit(1);
+			}
+		}
+	}
+
+	gf_fin(&field);
+}
+
 static void test_gen_gen_qrc(void)
 {
 	/*
@@ -563,6 +715,61 @@ static void test_gen_gen(unsigned int poly, int rpow, int len,
 	free(buf);
 }
 
+/*
+ * Check gf_mul_add() and p_mul() against gf_mult(), with lengths that
+ * exercise the tails of every kernel.
+ */
+static void test_mul_add(unsigned int poly)
+{
+	unsigned char src[80], dst[80], ref[80];
+	unsigned char pa[7], prod[86], pref[86];
+	struct gf field;
+	unsigned int c;
+	int len;
+	int i, j;
+	int rc;
+
+	rc = gf_init(&field, poly);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": gf_init(0x%x) error: %d\n", poly, rc);
+		exit(1);
+	}
+
+	srand(poly);
+	for (len = 1; len <= 80; len++) {
+		for (c = 0; c < 256; c += 17) {
+			for (i = 0; i < len; i++) {
+				src[i] = rand();
+				dst[i] = rand();
+				ref[i] = dst[i] ^ gf_mult(&field, c, src[i]);
+			}
+			gf_mul_add(&field, dst, src, c, len);
+			if (memcmp(dst, ref, len) != 0) {
+				fprintf(stderr, TAG ": "
+				    "gf_mul_add(0x%x,0x%x,%d) mismatch\n",
+				    poly, c, len);
+				exit(1);
+			}
+		}
+
+		for (i = 0; i < sizeof(pa); i++)
+			pa[i] = rand();
+		memset(pref, 0, sizeof(pa) + len - 1);
+		for (i = 0; i < sizeof(pa); i++) {
+			for (j = 0; j < len; j++)
+				pref[i+j] ^= gf_mult(&field, pa[i], src[j]);
+		}
+		p_mul(&field, prod, sizeof(pa), pa, len, src);
+		if (memcmp(prod, pref, sizeof(pa) + len - 1) != 0) {
+			fprintf(stderr, TAG ": p_mul(0x%x,%d) mismatch\n",
+			    poly, len);
+			exit(1);
+		}
+	}
+
+	gf_fin(&field);
+}
+
 static void test_rem_qrc(void)
 {
 	static unsigned int sample_pp = 0x11d;
@@ -581,7 +788,7 @@ static void test_rem_qrc(void)
 	}
 
 	test_rem(&field, sizeof(sample_msg), sample_msg,
-	    sample_pp, sizeof(sample_gp), sample_gp, sample_rem);
+	    sample_pp, sizeof(sample_gp), sample_gp, 0, sample_rem);
 
 	gf_fin(&field);
 }
@@ -620,7 +827,7 @@ static void test_rem_uat1(void)
 	}
 
 	test_rem(&field, sizeof(sample_msg), sample_msg,
-	    sample_pp, sizeof(sample_gp), sample_gp, sample_rem);
+	    sample_pp, sizeof(sample_gp), sample_gp, 120, sample_rem);
 
 	gf_fin(&field);
 }
@@ -659,7 +866,7 @@ static void test_rem_uat2(void)
 	}
 
 	test_rem(&field, sizeof(sample_msg), sample_msg,
-	    sample_pp, sizeof(sample_gp), sample_gp, sample_rem);
+	    sample_pp, sizeof(sample_gp), sample_gp, 120, sample_rem);
 
 	gf_fin(&field);
 }
@@ -701,7 +908,7 @@ static void test_rem_uat3(void)
 	}
 
 	test_rem(&field, sizeof(sample_msg), sample_msg,
-	    sample_pp, sizeof(sample_gp), sample_gp, sample_rem);
+	    sample_pp, sizeof(sample_gp), sample_gp, 120, sample_rem);
 
 	gf_fin(&field);
 }
@@ -710,12 +917,14 @@ static void test_rem_uat3(void)
  * Since we have tested gen_gen above, we should be able to generate
  * what is taken by gpoly[] argument from ppoly and gplen. But we focus
  * on testing p_rem() for now and use pre-cooked poly from samples above.
+ * The rs_rem() of a code built on the same poly must produce the same.
  */
 static void test_rem(struct gf *f, int mlen, const unsigned char *msg,
-    unsigned int ppoly, int gplen, const unsigned char *gpoly,
+    unsigned int ppoly, int gplen, const unsigned char *gpoly, int fcr,
     const unsigned char *sample)
 {
 	int rlen = gplen - 1;
+	struct rs_code code;
 	unsigned char *buf;
 
 	buf = malloc(rlen + 2);
@@ -754,5 +963,975 @@ static void test_rem(struct gf *f, int mlen, const unsigned char *msg,
 		exit(1);
 	}
 
+	if (rs_code_init(&code, f, gpoly, mlen + rlen, rlen, fcr) != 0) {
+		fprintf(stderr, TAG ": rs_code_init(%d,%d) error\n",
+		    mlen + rlen, rlen);
+		exit(1);
+	}
+	memset(buf, 0xe5, rlen+2);
+	rs_rem(&code, buf+1, mlen, msg);
+	if (buf[0] != 0xe5 || buf[rlen+1] != 0xe5) {
+		fprintf(stderr, TAG ": "
+		    "rs_rem(0x%x,%d,...) destination overflow\n",
+		    ppoly, rlen);
+		exit(1);
+	}
+	if (memcmp(buf+1, sample, rlen) != 0) {
+		fprintf(stderr, TAG ": "
+		    "rs_rem(0x%x,%d,...) sample mismatch\n",
+		    ppoly, rlen);
+		exit(1);
+	}
+	rs_code_fin(&code);
+
 	free(buf);
 }
+
+static void test_rs_uat(void)
+{
+	struct gf field;
+	int rc;
+
+	rc = gf_init(&field, GF256_POLY_UAT);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": gf_init(0x%x) error: %d\n",
+		    GF256_POLY_UAT, rc);
+		exit(1);
+	}
+
+	test_rs(&field, 30, 12, 120);		/* ADS-B short */
+	test_rs(&field, 48, 14, 120);		/* ADS-B long */
+	test_rs(&field, 92, 20, 120);		/* Uplink */
+	test_rs_ilv(&field);
+	test_rs_eras(&field, 30, 12, 120);
+	test_rs_eras(&field, 92, 20, 120);
+
+	gf_fin(&field);
+}
+
+/*
+ * Encode random messages with p_rem(), damage them with up to t errors,
+ * and check that rs_decode() restores them. Then, damage them beyond t
+ * and check that the decoder at least does not claim more than t.
+ */
+static void test_rs(struct gf *f, int n, int nroots, int fcr)
+{
+	enum { NTRIES = 200 };
+	unsigned char gpoly[RS_MAXROOTS+1];
+	unsigned char msg[255], cw[255];
+	struct rs_code code;
+	int k = n - nroots;
+	int tries, nerr;
+	int i, x;
+	int rc;
+
+	rc = p_gen_gen(f, gpoly, fcr, fcr + nroots);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": p_gen_gen(%d,%d) error: %d\n",
+		    fcr, fcr + nroots, rc);
+		exit(1);
+	}
+	rc = rs_code_init(&code, f, gpoly, n, nroots, fcr);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": rs_code_init(%d,%d) error: %d\n",
+		    n, nroots, rc);
+		exit(1);
+	}
+
+	srand(n);
+	for (tries = 0; tries < NTRIES; tries++) {
+		for (i = 0; i < k; i++)
+			msg[i] = rand();
+		p_rem(f, msg + k, nroots, k, msg, gpoly);
+
+		if (rs_check(&code, msg) != 0) {
+			fprintf(stderr, TAG ": "
+			    "rs_check(%d,%d) fails a clean codeword\n", n, k);
+			exit(1);
+		}
+
+		nerr = tries % (nroots/2 + 1);
+		memcpy(cw, msg, n);
+		for (i = 0; i < nerr; i++) {
+			/* Positions may repeat, which only reduces the count */
+			x = rand() % n;
+			cw[x] ^= 1 + rand() % 255;
+		}
+		for (i = 0, nerr = 0; i < n; i++) {
+			if (cw[i] != msg[i])
+				nerr++;
+		}
+
+		if (rs_check(&code, cw) != (nerr != 0)) {
+			fprintf(stderr, TAG ": "
+			    "rs_check(%d,%d) errors %d missed\n", n, k, nerr);
+			exit(1);
+		}
+
+		rc = rs_decode(&code, cw);
+		if (rc != nerr || memcmp(cw, msg, n) != 0) {
+			fprintf(stderr, TAG ": "
+			    "rs_decode(%d,%d) errors %d returned %d\n",
+			    n, k, nerr, rc);
+			exit(1);
+		}
+
+		for (i = 0; i < nroots/2 + 1; i++)
+			cw[i] ^= 1 + rand() % 255;
+		rc = rs_decode(&code, cw);
+		if (rc > nroots/2) {
+			fprintf(stderr, TAG ": "
+			    "rs_decode(%d,%d) uncorrectable returned %d\n",
+			    n, k, rc);
+			exit(1);
+		}
+	}
+
+	rs_code_fin(&code);
+}
+
+/*
+ * Damage codewords beyond t, but mark some of the damaged symbols as
+ * unreliable, so that rs_decode_soft() can erase them. Every erasure
+ * costs 1 root and every remaining error costs 2.
+ */
+static void test_rs_eras(struct gf *f, int n, int nroots, int fcr)
+{
+	enum { NTRIES = 200 };
+	unsigned char gpoly[RS_MAXROOTS+1];
+	unsigned char msg[255], cw[255], rel[255];
+	struct rs_code code;
+	int k = n - nroots;
+	int tries, neras, nerr, nbad;
+	int i, x;
+	int rc;
+
+	p_gen_gen(f, gpoly, fcr, fcr + nroots);
+	if (rs_code_init(&code, f, gpoly, n, nroots, fcr) != 0) {
+		fprintf(stderr, TAG ": rs_code_init(%d,%d) error\n",
+		    n, nroots);
+		exit(1);
+	}
+
+	srand(n + 1);
+	for (tries = 0; tries < NTRIES; tries++) {
+		for (i = 0; i < k; i++)
+			msg[i] = rand();
+		rs_rem(&code, msg + k, k, msg);
+		memcpy(cw, msg, n);
+		memset(rel, 200, n);
+
+		/*
+		 * Even number of erasures, since that's how we step. Up to t,
+		 * because with more, a miscorrection at one of the earlier
+		 * steps is all too likely, which is the trade-off of maxeras.
+		 */
+		neras = 2 + 2 * (tries % (nroots/4));
+		nerr = (nroots - neras) / 2;
+		for (i = 0; i < neras + nerr; i++) {
+			/* Stride 7 is co-prime with n, so no repeats. */
+			x = (tries + i * 7) % n;
+			cw[x] ^= 1 + rand() % 255;
+			if (i < neras)
+				rel[x] = i;	/* erasures are in any order */
+		}
+		nbad = neras + nerr;
+
+		rc = rs_decode_soft(&code, cw, rel, neras);
+		if (rc != nbad || memcmp(cw, msg, n) != 0) {
+			fprintf(stderr, TAG ": rs_decode_soft(%d,%d)"
+			    " erasures %d errors %d returned %d\n",
+			    n, k, neras, nerr, rc);
+			exit(1);
+		}
+	}
+
+	rs_code_fin(&code);
+}
+
+/*
+ * Interleave 6 Uplink blocks the way they are transmitted, damage some
+ * of them, and check that rs_decode_ilv() sorts them out block by block.
+ */
+static void test_rs_ilv(struct gf *f)
+{
+	enum { NTRIES = 50, LANES = 6, N = 92, NROOTS = 20 };
+	unsigned char gpoly[NROOTS+1];
+	unsigned char msg[LANES*N], ilv[LANES*N], out[LANES*N];
+	struct rs_code code;
+	int status[LANES], nerr[LANES];
+	int tries, bad, expbad;
+	int i, b, x;
+
+	p_gen_gen(f, gpoly, 120, 120 + NROOTS);
+	if (rs_code_init(&code, f, gpoly, N, NROOTS, 120) != 0) {
+		fprintf(stderr, TAG ": rs_code_init(%d,%d) error\n",
+		    N, NROOTS);
+		exit(1);
+	}
+
+	srand(LANES);
+	for (tries = 0; tries < NTRIES; tries++) {
+		for (b = 0; b < LANES; b++) {
+			for (i = 0; i < N - NROOTS; i++)
+				msg[b*N + i] = rand();
+			rs_rem(&code, msg + b*N + N-NROOTS, N-NROOTS,
+			    msg + b*N);
+		}
+		for (i = 0; i < LANES*N; i++)
+			ilv[i] = msg[(i%LANES)*N + i/LANES];
+
+		/* Lane 5 gets t+1 errors every other try, and is lost. */
+		expbad = 0;
+		for (b = 0; b < LANES; b++) {
+			nerr[b] = (tries + b) % (NROOTS/2 + 1);
+			if (b == 5 && tries % 2) {
+				nerr[b] = NROOTS/2 + 1;
+				expbad++;
+			}
+			for (i = 0; i < nerr[b]; i++) {
+				x = (i * 7 + tries) % N;
+				ilv[x*LANES + b] ^= 1 + rand() % 255;
+			}
+		}
+
+		bad = rs_decode_ilv(&code, out, ilv, NULL, 0, LANES, status);
+		for (b = 0; b < LANES; b++) {
+			if (b == 5 && tries % 2) {
+				if (status[b] > NROOTS/2) {
+					fprintf(stderr, TAG ": rs_decode_ilv"
+					    " uncorrectable returned %d\n",
+					    status[b]);
+					exit(1);
+				}
+				continue;
+			}
+			if (status[b] != nerr[b] ||
+			    memcmp(out + b*N, msg + b*N, N) != 0) {
+				fprintf(stderr, TAG ": rs_decode_ilv lane %d"
+				    " errors %d returned %d\n",
+				    b, nerr[b], status[b]);
+				exit(1);
+			}
+		}
+		/* A miscorrection of the lost lane is possible, if rare. */
+		if (bad > expbad) {
+			fprintf(stderr, TAG ": rs_decode_ilv"
+			    " bad %d expected %d\n", bad, expbad);
+			exit(1);
+		}
+	}
+
+	rs_code_fin(&code);
+}
+
+/*
+ * Report what it costs to verify a clean Uplink codeword, which is what
+ * the receiver does most of the time. Uses the sample from test_rem_uat2().
+ */
+static void time_check_uat(int level)
+{
+	enum { NLOOPS = 20000 };
+	static unsigned char sample_cw[92] = {
+	    0x32, 0x15, 0xfb, 0x68, 0x9a, 0x02, 0xb3, 0x90, 0x51, 0x00,
+	    0x00, 0x2d, 0x0f, 0xc5, 0x68, 0x82, 0x10, 0x00, 0x00, 0x00,
+	    0xff, 0x25, 0xce, 0x81, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xef,
+	    0xd3, 0x15, 0x01, 0x1f, 0x02, 0x2d, 0x01, 0x1f, 0x09, 0x00,
+	    0xb9, 0xb9, 0x23, 0xb5, 0x88, 0xdc, 0xb7, 0x7f, 0x63, 0xae,
+	    0x54, 0xdc, 0xb7, 0x75, 0x03, 0x4a, 0xdc, 0xdc, 0xb6, 0xbd,
+	    0xa3, 0x4b, 0x74, 0xdc, 0xb6, 0xc2, 0xa3, 0x09, 0xf0, 0xdc,
+	    0xb9, 0xf4,
+	    0x51, 0xd9, 0x87, 0xd6, 0x34, 0xbe, 0xec, 0x6d, 0x7e, 0xdf,
+	    0xd4, 0xb9, 0x45, 0x4a, 0x92, 0xc7, 0x5a, 0xa2, 0x04, 0x8f
+	};
+	unsigned char gpoly[21];
+	unsigned char rem[20];
+	struct gf field;
+	struct rs_code code;
+	unsigned char ilv[6*92], out[6*92];
+	int status[6];
+	unsigned long long t0, t_check, t_rem, t_rsrem, t_ilv;
+	int bad;
+	int i;
+	int rc;
+
+	rc = gf_init(&field, GF256_POLY_UAT);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": gf_init(0x%x) error: %d\n",
+		    GF256_POLY_UAT, rc);
+		exit(1);
+	}
+	p_gen_gen(&field, gpoly, 120, 140);
+	if (rs_code_init(&code, &field, gpoly, 92, 20, 120) != 0) {
+		fprintf(stderr, TAG ": rs_code_init(92,20) error\n");
+		exit(1);
+	}
+
+	bad = 0;
+	t0 = cycles();
+	for (i = 0; i < NLOOPS; i++)
+		bad += rs_check(&code, sample_cw);
+	t_check = cycles() - t0;
+
+	t0 = cycles();
+	for (i = 0; i < NLOOPS; i++) {
+		p_rem(&field, rem, 20, 72, sample_cw, gpoly);
+		bad += memcmp(rem, sample_cw + 72, 20) != 0;
+	}
+	t_rem = cycles() - t0;
+
+	t0 = cycles();
+	for (i = 0; i < NLOOPS; i++) {
+		rs_rem(&code, rem, 72, sample_cw);
+		bad += memcmp(rem, sample_cw + 72, 20) != 0;
+	}
+	t_rsrem = cycles() - t0;
+
+	for (i = 0; i < 6*92; i++)
+		ilv[i] = sample_cw[i/6];
+	t0 = cycles();
+	for (i = 0; i < NLOOPS; i++)
+		bad += rs_decode_ilv(&code, out, ilv, NULL, 0, 6, status);
+	t_ilv = cycles() - t0;
+
+	if (bad != 0) {
+		fprintf(stderr, TAG ": timed Uplink sample is not clean\n");
+		exit(1);
+	}
+
+	printf(TAG ": simd %d RS(92,72) clean check: rs_check %llu p_rem %llu"
+	    " rs_rem %llu rs_decode_ilv %llu " CYCLES_UNIT "/codeword\n",
+	    level, t_check / NLOOPS, t_rem / NLOOPS, t_rsrem / NLOOPS,
+	    t_ilv / NLOOPS / 6);
+
+	rs_code_fin(&code);
+	gf_fin(&field);
+}
+
+#define RING_TEST_SLOTS  8
+#define RING_TEST_BUFS   200000
+
+static void test_ring(void)
+{
+	struct ring ring;
+	pthread_t thread;
+	unsigned int *p;
+	unsigned int i, seq;
+	size_t len;
+	int rc;
+
+	if (ring_init(&ring, 6, sizeof(int)) == 0) {
+		fprintf(stderr, TAG ": ring of 6 slots is accepted\n");
+		exit(1);
+	}
+	if (ring_init(&ring, RING_TEST_SLOTS, sizeof(int)) != 0) {
+		fprintf(stderr, TAG ": ring_init error\n");
+		exit(1);
+	}
+
+	/* Fill it up, overflow it, and drain it, twice to wrap around */
+	for (seq = 0; seq < 2 * RING_TEST_SLOTS; seq += RING_TEST_SLOTS) {
+		for (i = 0; i < RING_TEST_SLOTS; i++) {
+			p = ring_claim(&ring);
+			assert(p != NULL);
+			*p = seq + i;
+			ring_commit(&ring, i);
+		}
+		if (ring_claim(&ring) != NULL || ring_claim(&ring) != NULL) {
+			fprintf(stderr, TAG ": claimed a slot of a full ring\n");
+			exit(1);
+		}
+		if (ring_wait(&ring, 0) != 1) {
+			fprintf(stderr, TAG ": full ring is not ready\n");
+			exit(1);
+		}
+		for (i = 0; i < RING_TEST_SLOTS; i++) {
+			p = ring_peek(&ring, &len);
+			assert(p != NULL);
+			assert(*p == seq + i && len == i);
+			ring_release(&ring);
+		}
+		if (ring_peek(&ring, &len) != NULL || ring_wait(&ring, 0) != 0) {
+			fprintf(stderr, TAG ": drained ring is not empty\n");
+			exit(1);
+		}
+	}
+	if (ring_drops(&ring) != 4) {
+		fprintf(stderr, TAG ": ring dropped %lu, not 4\n",
+		    ring_drops(&ring));
+		exit(1);
+	}
+	ring_fini(&ring);
+
+	/*
+	 * Now with a producer thread, which is faster than us: every buffer
+	 * that we got must be in order, and together with the drops they
+	 * must add up.
+	 */
+	if (ring_init(&ring, RING_TEST_SLOTS, sizeof(int)) != 0) {
+		fprintf(stderr, TAG ": ring_init error\n");
+		exit(1);
+	}
+	rc = pthread_create(&thread, NULL, test_ring_producer, &ring);
+	if (rc != 0) {
+		fprintf(stderr, TAG ": pthread_create error: %d\n", rc);
+		exit(1);
+	}
+	i = 0;
+	seq = 0;
+	while (ring_wait(&ring, -1) > 0) {
+		while ((p = ring_peek(&ring, &len)) != NULL) {
+			if (i != 0 && *p <= seq) {
+				fprintf(stderr,
+				    TAG ": ring out of order: %u after %u\n",
+				    *p, seq);
+				exit(1);
+			}
+			seq = *p;
+			i++;
+			ring_release(&ring);
+		}
+	}
+	pthread_join(thread, NULL);
+	if (i + ring_drops(&ring) != RING_TEST_BUFS) {
+		fprintf(stderr, TAG ": ring lost buffers: %u + %lu\n",
+		    i, ring_drops(&ring));
+		exit(1);
+	}
+	ring_fini(&ring);
+}
+
+static void *test_ring_producer(void *arg)
+{
+	struct ring *r = arg;
+	unsigned int *p;
+	unsigned int i;
+
+	for (i = 0; i < RING_TEST_BUFS; i++) {
+		if ((p = ring_claim(r)) != NULL) {
+			*p = i;
+			ring_commit(r, sizeof(int));
+		}
+	}
+	ring_close(r);
+	return NULL;
+}
+
+/*
+ * Lines must come out whole and in order, and the hex must be right.
+ * The whole output fits into the pipe, so we read it after the fact.
+ */
+#define WRITER_TEST_LINES  200
+
+static void test_writer(void)
+{
+	struct writer w;
+	unsigned char data[8];
+	char line[40], *lp;
+	static char expect[WRITER_TEST_LINES * 20], got[sizeof(expect) + 1];
+	int elen, glen;
+	int fds[2];
+	int i, j;
+	int rc;
+
+	if (pipe(fds) != 0) {
+		fprintf(stderr, TAG ": pipe error\n");
+		exit(1);
+	}
+	/* A small batch and a latency, so both of the triggers happen */
+	if (writer_init(&w, fds[1], 256, 5) != 0) {
+		fprintf(stderr, TAG ": writer_init error\n");
+		exit(1);
+	}
+	elen = 0;
+	for (i = 0; i < WRITER_TEST_LINES; i++) {
+		for (j = 0; j < 8; j++)
+			data[j] = i * 8 + j * 37;
+		lp = line;
+		*lp++ = '-';
+		lp = hex_put(lp, data, 8);
+		*lp++ = '\n';
+		if (writer_put(&w, line, lp - line) != 0) {
+			fprintf(stderr, TAG ": writer dropped line %d\n", i);
+			exit(1);
+		}
+		elen += sprintf(expect + elen, "-");
+		for (j = 0; j < 8; j++)
+			elen += sprintf(expect + elen, "%02x", data[j]);
+		elen += sprintf(expect + elen, "\n");
+		if (i % 50 == 0)
+			usleep(10000);
+	}
+	assert(writer_drops(&w) == 0);
+	writer_fini(&w);
+	close(fds[1]);
+
+	glen = 0;
+	while ((rc = read(fds[0], got + glen, sizeof(got) - glen)) > 0)
+		glen += rc;
+	close(fds[0]);
+	if (glen != elen || memcmp(got, expect, elen) != 0) {
+		fprintf(stderr, TAG ": writer output mismatch, %d of %d\n",
+		    glen, elen);
+		exit(1);
+	}
+}
+
+/*
+ * Two clients: one takes every message back intact, and the other one
+ * never reads, so it has to be cut off instead of blocking the publisher.
+ */
+#define SERVE_TEST_MSGS  1000
+#define SERVE_TEST_BULK  (4*1024*1024)
+
+static void test_serve(void)
+{
+	struct server s;
+	char path_b[40], path_t[40];
+	unsigned char msg[64], got[64];
+	static char bulk[1024];
+	int fd_b, fd_t;
+	int i, j, n;
+	int rc;
+
+	snprintf(path_b, sizeof(path_b), "/tmp/tester.%d.b", (int) getpid());
+	snprintf(path_t, sizeof(path_t), "/tmp/tester.%d.t", (int) getpid());
+	if (serve_init(&s) != 0 ||
+	    serve_listen(&s, path_b, SERVE_BIN) != 0 ||
+	    serve_listen(&s, path_t, SERVE_TEXT) != 0 ||
+	    serve_start(&s) != 0) {
+		fprintf(stderr, TAG ": serve setup error\n");
+		exit(1);
+	}
+	fd_b = serve_connect(&s, path_b, SERVE_BIN);
+	fd_t = serve_connect(&s, path_t, SERVE_TEXT);
+
+	for (i = 0; i < SERVE_TEST_MSGS; i++) {
+		n = 1 + i % sizeof(msg);
+		for (j = 0; j < n; j++)
+			msg[j] = i + j;
+		serve_publish(&s, SERVE_BIN, msg, n);
+		for (j = 0; j < n; j += rc) {
+			rc = read(fd_b, got + j, n - j);
+			if (rc <= 0) {
+				fprintf(stderr, TAG ": serve read error\n");
+				exit(1);
+			}
+		}
+		if (memcmp(got, msg, n) != 0) {
+			fprintf(stderr, TAG ": serve mismatch at %d\n", i);
+			exit(1);
+		}
+	}
+
+	for (i = 0; i < SERVE_TEST_BULK / sizeof(bulk); i++)
+		serve_publish(&s, SERVE_TEXT, bulk, sizeof(bulk));
+	assert(serve_slow(&s) == 1);
+	/* The binary client is unaffected */
+	serve_publish(&s, SERVE_BIN, msg, 1);
+	if (read(fd_b, got, 1) != 1 || got[0] != msg[0]) {
+		fprintf(stderr, TAG ": serve lost a client\n");
+		exit(1);
+	}
+
+	serve_fini(&s);
+	close(fd_t);
+	close(fd_b);
+	assert(access(path_b, F_OK) != 0);
+}
+
+static int serve_connect(struct server *s, const char *path, int kind)
+{
+	struct sockaddr_un sun;
+	int fd;
+	int i;
+
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	memset(&sun, 0, sizeof(sun));
+	sun.sun_family = AF_UNIX;
+	strcpy(sun.sun_path, path);
+	if (fd == -1 ||
+	    connect(fd, (struct sockaddr *) &sun, sizeof(sun)) != 0) {
+		fprintf(stderr, TAG ": connect error\n");
+		exit(1);
+	}
+	/* The accept is in the thread of the server, wait for it */
+	for (i = 0; i < 1000 && !serve_wants(s, kind); i++)
+		usleep(1000);
+	if (!serve_wants(s, kind)) {
+		fprintf(stderr, TAG ": serve did not accept\n");
+		exit(1);
+	}
+	return fd;
+}
+
+#define SOURCE_TEST_BYTES  (600*1024 + 1)
+
+static const struct source_ops *const test_sources[] = {
+	&source_cu8, &source_synth, NULL
+};
+
+/*
+ * A file comes back as it was, less the half of a sample at the end,
+ * and the generator makes as many samples as it was asked for.
+ */
+static void test_source(void)
+{
+	static unsigned char data[SOURCE_TEST_BYTES];
+	char path[] = "/tmp/ruat_test_XXXXXX";
+	char spec[sizeof(path) + 4];
+	struct source src;
+	struct source_conf conf;
+	struct source_stats st;
+	const void *p;
+	size_t len, off;
+	int fd;
+	int i;
+
+	for (i = 0; i < SOURCE_TEST_BYTES; i++)
+		data[i] = i * 7 + (i >> 9);
+	if ((fd = mkstemp(path)) == -1) {
+		fprintf(stderr, TAG ": mkstemp error\n");
+		exit(1);
+	}
+	if (write(fd, data, SOURCE_TEST_BYTES) != SOURCE_TEST_BYTES) {
+		fprintf(stderr, TAG ": write error\n");
+		exit(1);
+	}
+	close(fd);
+
+	memset(&conf, 0, sizeof(conf));
+	conf.format = SOURCE_CU8;
+	conf.rate = 2083334;
+	sprintf(spec, "cu8:%s", path);
+	if (source_open(&src, test_sources, spec, &conf) != 0 ||
+	    source_start(&src) != 0) {
+		fprintf(stderr, TAG ": source_open(%s) error\n", spec);
+		exit(1);
+	}
+	assert(src.format == SOURCE_CU8 && !src.live);
+	off = 0;
+	while (source_get(&src, &p, &len, 1000) == 1) {
+		assert(len % 2 == 0);
+		assert(off + len < SOURCE_TEST_BYTES);
+		if (memcmp(p, data + off, len) != 0) {
+			fprintf(stderr, TAG ": source data mismatch at %zu\n",
+			    off);
+			exit(1);
+		}
+		off += len;
+		source_put(&src);
+	}
+	assert(off == SOURCE_TEST_BYTES - 1);
+	source_stats(&src, &st);
+	assert(st.samples == off / 2 && st.drops == 0);
+	source_stop(&src);
+	source_close(&src);
+	unlink(path);
+
+	if (source_open(&src, test_sources, "synth:0.5,10", &conf) != 0 ||
+	    source_start(&src) != 0) {
+		fprintf(stderr, TAG ": source_open(synth) error\n");
+		exit(1);
+	}
+	while (source_get(&src, &p, &len, 1000) == 1)
+		source_put(&src);
+	source_stats(&src, &st);
+	assert(st.samples == (conf.rate / 2 * 2 & ~7UL) / 2);
+	source_stop(&src);
+	source_close(&src);
+
+	if (source_open(&src, test_sources, "nosuch:0", &conf) == 0) {
+		fprintf(stderr, TAG ": source_open(nosuch) succeeded\n");
+		exit(1);
+	}
+	if (source_open(&src, test_sources, "synth:x", &conf) == 0) {
+		fprintf(stderr, TAG ": source_open(synth:x) succeeded\n");
+		exit(1);
+	}
+}
+
+static void test_synth_truth(void *arg, const struct synth_burst *bp)
+{
+	(*(int *) arg)++;
+	assert(bp->end > bp->start);
+}
+
+/*
+ * The packets of the synthesizer are valid codewords, and every burst
+ * of a period is told to the truth.
+ */
+static void test_synth(void)
+{
+	static unsigned char buf[2 * 2 * (2 * 6250 + 1000)];
+	struct rs_code code_up, code_as, code_al;
+	unsigned char frame[6*92], cw[92];
+	struct synth_conf conf;
+	struct synth_burst burst;
+	struct synth synth;
+	int kind, len, b, i;
+	int nbursts;
+	int bad;
+
+	if (rs_code_init(&code_up, &gf_uat, gpoly_uat_up, 92, 20, 120) != 0 ||
+	    rs_code_init(&code_as, &gf_uat, gpoly_uat_as, 30, 12, 120) != 0 ||
+	    rs_code_init(&code_al, &gf_uat, gpoly_uat_al, 48, 14, 120) != 0) {
+		fprintf(stderr, TAG ": rs_code_init error\n");
+		exit(1);
+	}
+	memset(&conf, 0, sizeof(conf));
+	conf.format = SYNTH_CU8;
+	conf.rate = 2 * SYNTH_BAUD;
+	conf.snr = 20;
+	if (synth_init(&synth, &conf) != 0) {
+		fprintf(stderr, TAG ": synth_init error\n");
+		exit(1);
+	}
+
+	for (kind = SYNTH_AS; kind <= SYNTH_UP; kind++) {
+		len = synth_packet(&synth, kind, frame, &burst);
+		assert(burst.kind == kind);
+		if (kind == SYNTH_AS) {
+			assert(len == 30 && burst.dlen == 18);
+			bad = rs_check(&code_as, frame);
+		} else if (kind == SYNTH_AL) {
+			assert(len == 48 && burst.dlen == 34);
+			bad = rs_check(&code_al, frame);
+		} else {
+			assert(len == 6*92 && burst.dlen == 6*72);
+			bad = 0;
+			for (b = 0; b < 6; b++) {
+				for (i = 0; i < 92; i++)
+					cw[i] = frame[i*6 + b];
+				bad |= rs_check(&code_up, cw);
+				assert(memcmp(cw, burst.data + b*72, 72) == 0);
+			}
+		}
+		if (bad) {
+			fprintf(stderr, TAG ": synth_packet(%d) fails FEC\n",
+			    kind);
+			exit(1);
+		}
+	}
+
+	/*
+	 * Two slots of 6250 bits, and a little. The burst of the third slot
+	 * would not end by the limit, so it is not sent.
+	 */
+	nbursts = 0;
+	synth.truth = test_synth_truth;
+	synth.truth_arg = &nbursts;
+	synth.limit = sizeof(buf) / 2;
+	synth_gen(&synth, buf, sizeof(buf) / 4);
+	synth_gen(&synth, buf, sizeof(buf) / 4);
+	assert(nbursts == 2);
+
+	synth_fini(&synth);
+	rs_code_fin(&code_al);
+	rs_code_fin(&code_as);
+	rs_code_fin(&code_up);
+}
+
+/*
+ * A tone just off the carrier comes out as it went in, turning the right
+ * way, but one in the next channel is gone.
+ */
+static void test_fir(void)
+{
+	double mag, dphi;
+
+	mag = test_fir_tone(100000, &dphi);
+	assert(mag > 900 && mag < 1100);
+	assert(fabs(dphi - 2 * M_PI * 100000 * FIR_M / FIR_L / 20e6) < 0.01);
+	mag = test_fir_tone(-200000, &dphi);
+	assert(mag > 900 && mag < 1100);
+	assert(fabs(dphi + 2 * M_PI * 200000 * FIR_M / FIR_L / 20e6) < 0.01);
+	mag = test_fir_tone(3000000, &dphi);
+	assert(mag < 10);
+
+	test_fir_packed();
+}
+
+/*
+ * Feed the filter a tone of 1000 at fs/4 + hz in pieces of odd sizes,
+ * and return the mean magnitude and step of the phase past the start.
+ */
+static double test_fir_tone(double hz, double *dphi)
+{
+	enum { NRAW = 48000, CHUNK = 4000 };
+	static unsigned char raw[NRAW * 2];
+	static int out[FIR_OUT_MAX(CHUNK) * (NRAW / CHUNK)];
+	struct fir fir;
+	double mag, step, d;
+	int i, n, off, len, nout;
+
+	for (i = 0; i < NRAW; i++) {
+		n = 2048 + lrint(1000 * cos(2 * M_PI * (5e6 + hz) * i / 20e6));
+		raw[2*i] = n & 0xff;
+		raw[2*i + 1] = n >> 8;
+	}
+	if (fir_init(&fir, CHUNK, 0) != 0) {
+		fprintf(stderr, TAG ": fir_init error\n");
+		exit(1);
+	}
+	nout = 0;
+	for (off = 0, i = 0; off < NRAW; off += len, i++) {
+		len = (i & 1) ? 1001 : CHUNK - 1001;
+		if (len > NRAW - off)
+			len = NRAW - off;
+		nout += fir_run(&fir, raw + 2*off, len, 2048, out + nout);
+	}
+	fir_fini(&fir);
+	assert(nout == NRAW * FIR_L / FIR_M * 2);
+
+	/* Past the window of the filter */
+	mag = 0;
+	step = 0;
+	for (i = 100; i < nout / 2; i++) {
+		mag += hypot(out[2*i], out[2*i + 1]);
+		d = atan2(out[2*i + 1], out[2*i]) -
+		    atan2(out[2*i - 1], out[2*i - 2]);
+		step += remainder(d, 2 * M_PI);
+	}
+	*dphi = step / (nout / 2 - 100);
+	return mag / (nout / 2 - 100);
+}
+
+/*
+ * The same samples, packed as Airspy does it, give the same output,
+ * with PSHUFB and without.
+ */
+#define FIR_TEST_SAMPLES  48000
+static void test_fir_packed(void)
+{
+	static unsigned char raw16[FIR_TEST_SAMPLES * 2];
+	static unsigned char raw12[FIR_TEST_SAMPLES / 8 * 12];
+	static unsigned short s[FIR_TEST_SAMPLES];
+	static int out16[FIR_OUT_MAX(FIR_TEST_SAMPLES)];
+	static int out12[FIR_OUT_MAX(FIR_TEST_SAMPLES)];
+	struct synth_conf conf;
+	struct synth synth;
+	int i, n, ssse3;
+
+	memset(&conf, 0, sizeof(conf));
+	conf.rate = 20000000;
+	conf.snr = 10;
+	conf.format = SYNTH_RAW16;
+	if (synth_init(&synth, &conf) != 0) {
+		fprintf(stderr, TAG ": synth_init error\n");
+		exit(1);
+	}
+	synth_gen(&synth, raw16, FIR_TEST_SAMPLES);
+	synth_fini(&synth);
+	conf.format = SYNTH_RAW12;
+	if (synth_init(&synth, &conf) != 0) {
+		fprintf(stderr, TAG ": synth_init error\n");
+		exit(1);
+	}
+	synth_gen(&synth, raw12, FIR_TEST_SAMPLES);
+	synth_fini(&synth);
+
+	fir_unpack12(s, raw12, FIR_TEST_SAMPLES);
+	for (i = 0; i < FIR_TEST_SAMPLES; i++)
+		assert(s[i] == (raw16[2*i + 1] << 8 | raw16[2*i]));
+
+	n = test_fir_run(0, 0, raw16, out16);
+	assert(n == FIR_TEST_SAMPLES * FIR_L / FIR_M * 2);
+	for (ssse3 = 0; ssse3 < 2; ssse3++) {
+		if (test_fir_run(1, ssse3, raw12, out12) != n ||
+		    memcmp(out16, out12, n * sizeof(int)) != 0) {
+			fprintf(stderr, TAG ": fir_run(raw12%s) mismatch\n",
+			    ssse3 ? ", ssse3" : "");
+			exit(1);
+		}
+	}
+}
+
+/* In pieces of whole groups of 8 that do not line up with anything */
+static int test_fir_run(int packed, int ssse3, const unsigned char *raw,
+    int *out)
+{
+	struct fir fir;
+	int off, len, nout, i;
+
+	if (fir_init(&fir, FIR_TEST_SAMPLES, packed) != 0) {
+		fprintf(stderr, TAG ": fir_init error\n");
+		exit(1);
+	}
+	if (!ssse3)
+		fir.ssse3 = 0;
+	nout = 0;
+	for (off = 0, i = 0; off < FIR_TEST_SAMPLES; off += len, i++) {
+		len = (i & 1) ? 8 * 37 : 8 * 1001;
+		if (len > FIR_TEST_SAMPLES - off)
+			len = FIR_TEST_SAMPLES - off;
+		nout += fir_run(&fir, raw + (packed ? off / 8 * 12 : off * 2),
+		    len, 2048, out + nout);
+	}
+	fir_fini(&fir);
+	return nout;
+}
+
+/*
+ * The levels of the block API are those of the plain sums, for windows
+ * and pieces of sizes that SIMD does not divide, and at full scale.
+ */
+#define UPD_TEST_PAIRS  10000
+static void test_upd(void)
+{
+	static int iq[UPD_TEST_PAIRS * 2];
+	struct upd_lvl lvl;
+	long long abs_i, abs_q, sq;
+	int i, n, off, peak;
+
+	srandom(3);
+	for (i = 0; i < UPD_TEST_PAIRS * 2; i++)
+		iq[i] = (int) (random() % 4095) - 2047;
+	iq[2 * 6007 + 1] = -2047;	/* in the last whole window */
+
+	if (upd_lvl_init(&lvl, 0) == 0) {
+		fprintf(stderr, TAG ": upd_lvl_init accepted 0\n");
+		exit(1);
+	}
+	if (upd_lvl_init(&lvl, 3001) != 0) {
+		fprintf(stderr, TAG ": upd_lvl_init error\n");
+		exit(1);
+	}
+	for (off = 0, i = 0; off < UPD_TEST_PAIRS; off += n, i++) {
+		n = (i & 1) ? 7 : 1333;
+		if (n > UPD_TEST_PAIRS - off)
+			n = UPD_TEST_PAIRS - off;
+		upd_lvl_run(&lvl, iq + off*2, n);
+	}
+	assert(lvl.windows == 3);
+	assert(lvl.n == UPD_TEST_PAIRS - 3 * 3001);
+
+	/* The last whole window */
+	abs_i = 0;
+	abs_q = 0;
+	sq = 0;
+	peak = 0;
+	for (i = 2 * 3001; i < 3 * 3001; i++) {
+		abs_i += abs(iq[2*i]);
+		abs_q += abs(iq[2*i + 1]);
+		sq += iq[2*i] * iq[2*i] + iq[2*i + 1] * iq[2*i + 1];
+		if (abs(iq[2*i]) > peak)
+			peak = abs(iq[2*i]);
+		if (abs(iq[2*i + 1]) > peak)
+			peak = abs(iq[2*i + 1]);
+	}
+	assert(lvl.avg_i == abs_i / 3001);
+	assert(lvl.avg_q == abs_q / 3001);
+	assert(lvl.power == sq / 3001);
+	assert(lvl.peak == peak);
+
+	assert(lvl.peak == 2047);
+
+	if (upd_power(iq + 2 * 2 * 3001, 3001) != sq / 3001 ||
+	    upd_power(iq + 2 * 6007, 1) !=
+	      iq[2 * 6007] * iq[2 * 6007] + 2047 * 2047 ||
+	    upd_power(iq, 0) != 0) {
+		fprintf(stderr, TAG ": upd_power mismatch\n");
+		exit(1);
+	}
+}
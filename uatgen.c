@@ -0,0 +1,231 @@
+/*
+ * uatgen: make a capture of UAT traffic, and say what's in it
+ *
+ * The capture is what rtl_sdr writes (cu8), or what Airspy sends in the
+ * raw mode (raw16, or raw12 packed), so ruat and ruat_airspy take it with
+ * -f or -i. The truth goes to a file of its own, one line per burst:
+ *
+ *   start end line
+ *
+ * where start and end are the numbers of the first sample of the sync
+ * and of the sample after the last bit, and line is what ruat prints
+ * for the packet, so the two can be compared with sort and join.
+ * The first line, after a #, has the settings.
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "synth.h"
+#include "writer.h"
+
+#define TAG "uatgen"
+
+#define GEN_CHUNK  (64*1024)	/* samples */
+
+struct param {
+	struct synth_conf conf;
+	double secs;
+	const char *out;
+	const char *truth;
+};
+
+static void truth_line(void *arg, const struct synth_burst *bp);
+static void params(struct param *par, int argc, char **argv);
+static void Usage(void);
+
+static struct param par;
+static unsigned char gen_buf[GEN_CHUNK * 2];
+
+int main(int argc, char **argv)
+{
+	struct synth synth;
+	FILE *ofp, *tfp;
+	unsigned long long total, n;
+	size_t len;
+
+	params(&par, argc, argv);
+
+	if (par.out == NULL || strcmp(par.out, "-") == 0) {
+		ofp = stdout;
+	} else if ((ofp = fopen(par.out, "w")) == NULL) {
+		fprintf(stderr, TAG ": %s: %s\n", par.out, strerror(errno));
+		exit(1);
+	}
+	tfp = NULL;
+	if (par.truth != NULL && (tfp = fopen(par.truth, "w")) == NULL) {
+		fprintf(stderr, TAG ": %s: %s\n", par.truth, strerror(errno));
+		exit(1);
+	}
+
+	if (synth_init(&synth, &par.conf) != 0)
+		exit(1);
+	if (tfp != NULL) {
+		fprintf(tfp, "# rate %lu format %s snr %g cfo %g timing %g"
+		    " density %g seed %llu\n",
+		    par.conf.rate,
+		    (par.conf.format == SYNTH_CU8) ? "cu8" :
+		    (par.conf.format == SYNTH_RAW16) ? "raw16" : "raw12",
+		    par.conf.snr, par.conf.cfo, par.conf.timing,
+		    par.conf.density, (unsigned long long) par.conf.seed);
+		synth.truth = truth_line;
+		synth.truth_arg = tfp;
+	}
+
+	/* Whole chunks of 8 samples, for the fs/4 of Airspy and its packing */
+	total = (unsigned long long) (par.secs * par.conf.rate) & ~7ULL;
+	synth.limit = total;
+	while (total != 0) {
+		n = (total < GEN_CHUNK) ? total : GEN_CHUNK;
+		synth_gen(&synth, gen_buf, n);
+		len = (par.conf.format == SYNTH_RAW12) ? n / 8 * 12 : n * 2;
+		if (fwrite(gen_buf, 1, len, ofp) != len) {
+			fprintf(stderr, TAG ": write error: %s\n",
+			    strerror(errno));
+			exit(1);
+		}
+		total -= n;
+	}
+	synth_fini(&synth);
+
+	if (fclose(ofp) != 0) {
+		fprintf(stderr, TAG ": write error: %s\n", strerror(errno));
+		exit(1);
+	}
+	if (tfp != NULL && fclose(tfp) != 0) {
+		fprintf(stderr, TAG ": %s: %s\n", par.truth, strerror(errno));
+		exit(1);
+	}
+	return 0;
+}
+
+static void truth_line(void *arg, const struct synth_burst *bp)
+{
+	char line[2*SYNTH_DATA_MAX + 4], *lp;
+
+	lp = line;
+	*lp++ = (bp->kind == SYNTH_UP) ? '+' : '-';
+	lp = hex_put(lp, bp->data, bp->dlen);
+	*lp++ = ';';
+	*lp = 0;
+	fprintf(arg, "%llu %llu %s\n", bp->start, bp->end, line);
+}
+
+static void params(struct param *par, int argc, char **argv)
+{
+	char *arg, *end;
+	double v;
+
+	par->conf.format = SYNTH_CU8;
+	par->conf.rate = 0;
+	par->conf.snr = 20;
+	par->secs = 10;
+
+	argv += 1;
+	while ((arg = *argv++) != NULL) {
+		if (arg[0] != '-' || arg[1] == 0 || arg[2] != 0)
+			Usage();
+		if (arg[1] == 'F') {
+			if ((arg = *argv++) == NULL)
+				Usage();
+			if (strcmp(arg, "cu8") == 0) {
+				par->conf.format = SYNTH_CU8;
+			} else if (strcmp(arg, "raw16") == 0) {
+				par->conf.format = SYNTH_RAW16;
+			} else if (strcmp(arg, "raw12") == 0) {
+				par->conf.format = SYNTH_RAW12;
+			} else {
+				fprintf(stderr,
+				    TAG ": Invalid format `%s'\n", arg);
+				exit(1);
+			}
+		} else if (arg[1] == 'k') {
+			if ((arg = *argv++) == NULL)
+				Usage();
+			par->conf.kinds = 0;
+			for (; *arg != 0; arg++) {
+				if (*arg == 's') {
+					par->conf.kinds |= 1 << SYNTH_AS;
+				} else if (*arg == 'l') {
+					par->conf.kinds |= 1 << SYNTH_AL;
+				} else if (*arg == 'u') {
+					par->conf.kinds |= 1 << SYNTH_UP;
+				} else {
+					fprintf(stderr,
+					    TAG ": Invalid kind `%c'\n", *arg);
+					exit(1);
+				}
+			}
+		} else if (arg[1] == 'o') {
+			if ((par->out = *argv++) == NULL)
+				Usage();
+		} else if (arg[1] == 'w') {
+			if ((par->truth = *argv++) == NULL)
+				Usage();
+		} else if (arg[1] == 'S') {
+			if ((arg = *argv++) == NULL)
+				Usage();
+			par->conf.seed = strtoull(arg, &end, 0);
+			if (*end != 0) {
+				fprintf(stderr,
+				    TAG ": Invalid seed `%s'\n", arg);
+				exit(1);
+			}
+		} else {
+			/* The rest are numbers */
+			if (argv[0] == NULL)
+				Usage();
+			v = strtod(argv[0], &end);
+			if (*end != 0) {
+				fprintf(stderr, TAG ": Invalid value `%s'\n",
+				    argv[0]);
+				exit(1);
+			}
+			argv++;
+			switch (arg[1]) {
+			case 'c':
+				par->conf.cfo = v;
+				break;
+			case 'd':
+				if (v < 0)
+					Usage();
+				par->conf.density = v;
+				break;
+			case 'n':
+				if (v < 0)
+					Usage();
+				par->secs = v;
+				break;
+			case 'r':
+				if (v < 2 * SYNTH_BAUD || v > 100000000)
+					Usage();
+				par->conf.rate = v;
+				break;
+			case 's':
+				par->conf.snr = v;
+				break;
+			case 't':
+				par->conf.timing = v;
+				break;
+			default:
+				Usage();
+			}
+		}
+	}
+	if (par->conf.rate == 0) {
+		par->conf.rate = (par->conf.format == SYNTH_CU8) ?
+		    2083334 : 20000000;
+	}
+}
+
+static void Usage(void)
+{
+	fprintf(stderr, "Usage: " TAG " [-F cu8|raw16|raw12] [-r rate]"
+	    " [-n seconds] [-s snr_db]\n"
+	    "       [-c carrier_offset_hz] [-t timing_bits]"
+	    " [-d bursts_per_second]\n"
+	    "       [-k slu] [-S seed] [-w truth] [-o capture|-]\n");
+	exit(1);
+}
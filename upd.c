@@ -4,9 +4,19 @@
 
 #include <stdlib.h>
 #include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "upd.h"
 
+/* Pairs per round of the SIMD sums, so that I^2 + Q^2 fit 32-bit lanes */
+#define UPD_ROUND  512
+
+#ifdef __SSE2__
+static int upd_sums_sse2(struct upd_sums *sp, const int *p, int num);
+#endif
+
 int upd_init(struct upd *up, int length)
 {
 	void *p;
@@ -42,3 +52,133 @@ void upd_fini(struct upd *up)
 	free(up->vec);
 	up->vec = NULL;
 }
+
+int upd_lvl_init(struct upd_lvl *lp, int window)
+{
+	if (window <= 0)
+		return -1;
+	memset(lp, 0, sizeof(struct upd_lvl));
+	lp->len = window;
+	return 0;
+}
+
+/*
+ * Add num pairs of I/Q to the window, and close it as many times as
+ * it fills up.
+ */
+void upd_lvl_run(struct upd_lvl *lp, const int *p, int num)
+{
+	int k;
+
+	while (num > 0) {
+		k = lp->len - lp->n;
+		if (k > num)
+			k = num;
+		upd_sums_add(&lp->acc, p, k);
+		lp->n += k;
+		p += k * 2;
+		num -= k;
+
+		if (lp->n == lp->len) {
+			lp->avg_i = lp->acc.abs_i / lp->len;
+			lp->avg_q = lp->acc.abs_q / lp->len;
+			lp->power = lp->acc.sq / lp->len;
+			lp->peak = lp->acc.peak;
+			lp->windows++;
+			memset(&lp->acc, 0, sizeof(struct upd_sums));
+			lp->n = 0;
+		}
+	}
+}
+
+/*
+ * The mean I^2 + Q^2 of num pairs, such as those of a burst.
+ */
+int upd_power(const int *p, int num)
+{
+	struct upd_sums s;
+
+	if (num <= 0)
+		return 0;
+	memset(&s, 0, sizeof(struct upd_sums));
+	upd_sums_add(&s, p, num);
+	return s.sq / num;
+}
+
+/*
+ * Add num pairs to the sums, such as a part of a burst that goes on
+ * across the buffers.
+ */
+void upd_sums_add(struct upd_sums *sp, const int *p, int num)
+{
+	int i, x, y;
+
+	i = 0;
+#ifdef __SSE2__
+	i = upd_sums_sse2(sp, p, num);
+#endif
+	for (; i < num; i++) {
+		x = abs(p[i*2]);
+		y = abs(p[i*2 + 1]);
+		sp->abs_i += x;
+		sp->abs_q += y;
+		sp->sq += x * x + y * y;
+		if (x > sp->peak)
+			sp->peak = x;
+		if (y > sp->peak)
+			sp->peak = y;
+	}
+}
+
+#ifdef __SSE2__
+static long long upd_hsum(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return (unsigned int) _mm_cvtsi128_si32(v);
+}
+
+/*
+ * Four pairs at a time, packed into 16 bits. PMADDWD of the pairs with
+ * themselves is I^2 + Q^2, and the absolute values split back into I and
+ * Q as the halves of 32-bit lanes. The lanes are summed up every round,
+ * before they can overflow. Returns the number of pairs done.
+ */
+static int upd_sums_sse2(struct upd_sums *sp, const int *p, int num)
+{
+	const __m128i lo = _mm_set1_epi32(0xffff);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i v, a, si, sq, ss, pk;
+	short pks[8];
+	int i, k, end;
+
+	pk = zero;
+	for (i = 0; i + 4 <= num; ) {
+		end = i + UPD_ROUND;
+		if (end > num)
+			end = num;
+		si = zero;
+		sq = zero;
+		ss = zero;
+		for (; i + 4 <= end; i += 4) {
+			v = _mm_packs_epi32(
+			    _mm_loadu_si128((const __m128i *) (p + i*2)),
+			    _mm_loadu_si128((const __m128i *) (p + i*2 + 4)));
+			a = _mm_max_epi16(v, _mm_sub_epi16(zero, v));
+			pk = _mm_max_epi16(pk, a);
+			si = _mm_add_epi32(si, _mm_and_si128(a, lo));
+			sq = _mm_add_epi32(sq, _mm_srli_epi32(a, 16));
+			ss = _mm_add_epi32(ss, _mm_madd_epi16(v, v));
+		}
+		sp->abs_i += upd_hsum(si);
+		sp->abs_q += upd_hsum(sq);
+		sp->sq += upd_hsum(ss);
+	}
+	_mm_storeu_si128((__m128i *) pks, pk);
+	for (k = 0; k < 8; k++) {
+		if (pks[k] > sp->peak)
+			sp->peak = pks[k];
+	}
+	return i;
+}
+#endif
@@ -19,3 +19,34 @@ struct upd {
 int upd_init(struct upd *up, int length);
 int upd_ate(struct upd *up, int p);
 void upd_fini(struct upd *up);
+
+/*
+ * The levels of I/Q, a buffer at a time instead of a sample
+ *
+ * The ints go in pairs of I and Q, as fir_run() puts them out, and must
+ * be within +-2047, as it clips them, so that the sums take 16 bits in
+ * SIMD. The window does not slide: when it fills up, its means are kept
+ * for whoever asks, and it starts over.
+ */
+struct upd_sums {
+	long long abs_i, abs_q;	/* of |I| and |Q| */
+	long long sq;		/* of I^2 + Q^2 */
+	int peak;		/* the biggest |I| or |Q| */
+};
+
+struct upd_lvl {
+	int len;		/* the window, in pairs */
+	int n;			/* pairs in it so far */
+	struct upd_sums acc;
+
+	/* Of the last whole window */
+	unsigned long windows;	/* 0 until the first one is done */
+	int avg_i, avg_q;
+	int power;		/* mean I^2 + Q^2 */
+	int peak;
+};
+
+int upd_lvl_init(struct upd_lvl *lp, int window);
+void upd_lvl_run(struct upd_lvl *lp, const int *p, int num);
+void upd_sums_add(struct upd_sums *sp, const int *p, int num);
+int upd_power(const int *p, int num);
@@ -0,0 +1,209 @@
+/*
+ * The writer: batched output in a thread of its own
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "writer.h"
+
+#define WRITER_SLACK  4		/* buffer size in batches */
+
+static void *writer_thread(void *arg);
+static void writer_out(struct writer *w, const char *p, size_t len);
+
+/*
+ * Two hex digits for every byte, so hex_put() is a copy per byte.
+ */
+static const char hex_tab[256][2] = {
+#define HD     "0123456789abcdef"
+#define H1(x)  { HD[(x) >> 4], HD[(x) & 15] }
+#define H4(x)  H1(x), H1((x)+1), H1((x)+2), H1((x)+3)
+#define H16(x) H4(x), H4((x)+4), H4((x)+8), H4((x)+12)
+#define H64(x) H16(x), H16((x)+16), H16((x)+32), H16((x)+48)
+	H64(0), H64(64), H64(128), H64(192)
+#undef H64
+#undef H16
+#undef H4
+#undef H1
+#undef HD
+};
+
+int writer_init(struct writer *w, int fd, size_t batch, int latency_ms)
+{
+	pthread_condattr_t ca;
+
+	memset(w, 0, sizeof(struct writer));
+	w->fd = fd;
+	w->latency_ms = latency_ms;
+	w->batch = batch;
+	w->size = batch * WRITER_SLACK;
+
+	if ((w->buf[0] = malloc(w->size)) == NULL)
+		goto err_buf0;
+	if ((w->buf[1] = malloc(w->size)) == NULL)
+		goto err_buf1;
+	pthread_mutex_init(&w->mutex, NULL);
+	/* The deadlines are on the same clock as w->first */
+	pthread_condattr_init(&ca);
+	pthread_condattr_setclock(&ca, CLOCK_MONOTONIC);
+	pthread_cond_init(&w->cond, &ca);
+	pthread_condattr_destroy(&ca);
+	pthread_cond_init(&w->room, NULL);
+	if (pthread_create(&w->thread, NULL, writer_thread, w) != 0)
+		goto err_thread;
+	return 0;
+
+err_thread:
+	pthread_cond_destroy(&w->room);
+	pthread_cond_destroy(&w->cond);
+	pthread_mutex_destroy(&w->mutex);
+	free(w->buf[1]);
+err_buf1:
+	free(w->buf[0]);
+err_buf0:
+	return -1;
+}
+
+/*
+ * Write out everything that's buffered, and stop the thread.
+ */
+void writer_fini(struct writer *w)
+{
+	pthread_mutex_lock(&w->mutex);
+	w->closed = 1;
+	pthread_cond_signal(&w->cond);
+	pthread_mutex_unlock(&w->mutex);
+	pthread_join(w->thread, NULL);
+
+	pthread_cond_destroy(&w->room);
+	pthread_cond_destroy(&w->cond);
+	pthread_mutex_destroy(&w->mutex);
+	free(w->buf[1]);
+	free(w->buf[0]);
+}
+
+void writer_block(struct writer *w, int block)
+{
+	pthread_mutex_lock(&w->mutex);
+	w->block = block;
+	pthread_mutex_unlock(&w->mutex);
+}
+
+/*
+ * Queue a line for writing. Returns -1 if it was dropped.
+ */
+int writer_put(struct writer *w, const char *line, size_t len)
+{
+	pthread_mutex_lock(&w->mutex);
+	/* The thread always takes a full buffer, so the wait is bounded */
+	while (w->block && w->fill + len > w->size && len <= w->size)
+		pthread_cond_wait(&w->room, &w->mutex);
+	if (w->fill + len > w->size) {
+		w->drops++;
+		pthread_mutex_unlock(&w->mutex);
+		return -1;
+	}
+	memcpy(w->buf[w->cur] + w->fill, line, len);
+	/*
+	 * The thread wants to know when to start the clock, and when
+	 * there's a batch. In between, it's asleep until the deadline.
+	 */
+	if (w->fill == 0) {
+		clock_gettime(CLOCK_MONOTONIC, &w->first);
+		pthread_cond_signal(&w->cond);
+	} else if (w->fill < w->batch && w->fill + len >= w->batch) {
+		pthread_cond_signal(&w->cond);
+	}
+	w->fill += len;
+	pthread_mutex_unlock(&w->mutex);
+	return 0;
+}
+
+unsigned long writer_drops(struct writer *w)
+{
+	unsigned long drops;
+
+	pthread_mutex_lock(&w->mutex);
+	drops = w->drops;
+	pthread_mutex_unlock(&w->mutex);
+	return drops;
+}
+
+/*
+ * Put len bytes of p as hex into dst, and return the end. No NUL.
+ */
+char *hex_put(char *dst, const unsigned char *p, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++) {
+		memcpy(dst, hex_tab[p[i]], 2);
+		dst += 2;
+	}
+	return dst;
+}
+
+static void *writer_thread(void *arg)
+{
+	struct writer *w = arg;
+	struct timespec deadline;
+	char *p;
+	size_t len;
+
+	pthread_mutex_lock(&w->mutex);
+	for (;;) {
+		if (w->fill == 0) {
+			if (w->closed)
+				break;
+			pthread_cond_wait(&w->cond, &w->mutex);
+			continue;
+		}
+		if (!w->closed && w->latency_ms != 0 && w->fill < w->batch) {
+			deadline = w->first;
+			deadline.tv_sec += w->latency_ms / 1000;
+			deadline.tv_nsec += (w->latency_ms % 1000) * 1000000L;
+			if (deadline.tv_nsec >= 1000000000L) {
+				deadline.tv_sec++;
+				deadline.tv_nsec -= 1000000000L;
+			}
+			if (pthread_cond_timedwait(&w->cond, &w->mutex,
+			    &deadline) != ETIMEDOUT)
+				continue;
+		}
+
+		p = w->buf[w->cur];
+		len = w->fill;
+		w->cur ^= 1;
+		w->fill = 0;
+		pthread_cond_broadcast(&w->room);
+		pthread_mutex_unlock(&w->mutex);
+
+		writer_out(w, p, len);
+
+		pthread_mutex_lock(&w->mutex);
+	}
+	pthread_mutex_unlock(&w->mutex);
+	return NULL;
+}
+
+static void writer_out(struct writer *w, const char *p, size_t len)
+{
+	ssize_t rc;
+
+	while (len != 0) {
+		rc = write(w->fd, p, len);
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			/* Nobody's listening, nothing we can do */
+			return;
+		}
+		p += rc;
+		len -= rc;
+	}
+}
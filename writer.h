@@ -0,0 +1,43 @@
+/*
+ * The writer: a thread that writes our output lines in batches
+ *
+ * The decoder only appends a line to a buffer in memory, and never waits
+ * for the file descriptor. The writer thread swaps the buffer for a spare
+ * one and writes it out in one go, as soon as the oldest line in it is
+ * latency_ms old, or batch bytes have piled up, whichever comes first.
+ * With latency_ms of 0, every line goes out as soon as the thread gets to
+ * it, but the lines that come while it's writing go out together.
+ *
+ * When the reader of the fd is so slow that the buffer fills up anyway,
+ * the lines are dropped and counted, instead of stalling the decoder.
+ * Unless writer_block() was called: then the decoder waits for room,
+ * which is what a replay of a file wants, see ruat.c.
+ */
+#include <pthread.h>
+#include <stddef.h>
+#include <time.h>
+
+struct writer {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	pthread_cond_t room;	/* a buffer was taken for writing */
+	pthread_t thread;
+	int fd;
+	int latency_ms;
+	size_t batch;		/* write when this much is buffered */
+	size_t size;		/* of every buffer, several batches */
+	char *buf[2];		/* one is filled, the other is written */
+	int cur;		/* the one being filled */
+	size_t fill;
+	struct timespec first;	/* when buf[cur] got its first line */
+	int closed;
+	int block;		/* wait for room instead of dropping */
+	unsigned long drops;	/* lines that did not fit */
+};
+
+int writer_init(struct writer *w, int fd, size_t batch, int latency_ms);
+void writer_fini(struct writer *w);
+void writer_block(struct writer *w, int block);
+int writer_put(struct writer *w, const char *line, size_t len);
+unsigned long writer_drops(struct writer *w);
+char *hex_put(char *dst, const unsigned char *p, int len);